@@ -0,0 +1,457 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <coroutine>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include "../include/TimerWheel.hpp"
+
+// A multi-phase enemy pattern written three ways: a virtual state machine
+// every enemy polls each tick, the same machine stored by value and woken by
+// the timer wheel the way EnemyStore wakes enemies, and a coroutine resumed by
+// the same wheel. All must end in the same state. The wheel-driven machine is
+// the fair baseline for the coroutine, polling also pays for the idle ticks.
+// The game ships the wheel-driven machine, the coroutine lives only here.
+// Usage: bench_behaviors [ticks]
+
+const float tickRate = 60.0f;
+const float dt = 1.0f / tickRate;
+
+struct Agent
+{
+    float x = 0.0f, y = 0.0f;
+    float vx = 0.0f, vy = 0.0f;
+    int shots = 0;
+};
+
+// Warden pattern, mixing what Circles, Squares and Spikers do, in ticks at
+// 60 per second: advance and rest twice, charge, dash, fire a three shot
+// burst, repeat
+const int advanceTicks = 60;
+const int restTicks = 30;
+const int advanceCount = 2;
+const int chargeTicks = 120;
+const int dashTicks = 18;
+const int burstShots = 3;
+const int shotTicks = 15;
+
+static int startDelay(uint32_t id)
+{
+    return 1 + static_cast<int>(id % 60);
+}
+
+// --- State machine ---
+
+// One phase change of the pattern, returns the ticks until the next one
+class WardenStates
+{
+public:
+    int next(Agent &agent)
+    {
+        switch (state)
+        {
+        case State::Start:
+            advances = 0;
+            return setVelocity(agent, 0.0f, 40.0f, advanceTicks, State::Advance);
+        case State::Advance:
+            return setVelocity(agent, 0.0f, 0.0f, restTicks, State::Rest);
+        case State::Rest:
+            if (++advances < advanceCount)
+                return setVelocity(agent, 0.0f, 40.0f, advanceTicks, State::Advance);
+            return setVelocity(agent, 0.0f, 0.0f, chargeTicks, State::Charge);
+        case State::Charge:
+            return setVelocity(agent, 120.0f, 60.0f, dashTicks, State::Dash);
+        case State::Dash:
+            shotsLeft = burstShots - 1;
+            agent.shots++;
+            return setVelocity(agent, 0.0f, 0.0f, shotTicks, State::Burst);
+        case State::Burst:
+            if (shotsLeft > 0)
+            {
+                shotsLeft--;
+                agent.shots++;
+                return shotTicks;
+            }
+            advances = 0;
+            return setVelocity(agent, 0.0f, 40.0f, advanceTicks, State::Advance);
+        }
+        return -1;
+    }
+
+private:
+    enum class State { Start, Advance, Rest, Charge, Dash, Burst };
+    State state = State::Start;
+    int advances = 0;
+    int shotsLeft = 0;
+
+    int setVelocity(Agent &agent, float vx, float vy, int ticks, State nextState)
+    {
+        agent.vx = vx;
+        agent.vy = vy;
+        state = nextState;
+        return ticks;
+    }
+};
+
+// Polled every tick, counting down its own timer
+class Pattern
+{
+public:
+    virtual ~Pattern() = default;
+    virtual void tick(Agent &agent) = 0;
+};
+
+class WardenMachine final : public Pattern
+{
+public:
+    explicit WardenMachine(int delay) : timer(delay) {}
+
+    void tick(Agent &agent) override
+    {
+        if (--timer > 0)
+            return;
+        timer = states.next(agent);
+    }
+
+private:
+    WardenStates states;
+    int timer;
+};
+
+// Woken by the timer wheel, like Enemy::wake()
+class TimedPattern
+{
+public:
+    virtual ~TimedPattern() = default;
+    virtual int wake(Agent &agent) = 0;
+};
+
+class WardenTimed : public TimedPattern
+{
+public:
+    int wake(Agent &agent) override { return states.next(agent); }
+
+private:
+    WardenStates states;
+};
+
+// --- Coroutine, resumed by the timer wheel ---
+
+// Fixed-size blocks for coroutine frames, so starting a behaviour does not
+// touch the heap once the pool has grown. The bench runs on one thread, so
+// the free list takes no lock.
+namespace FramePool
+{
+    const size_t blockSize = 256;
+    const size_t blocksPerChunk = 128;
+
+    struct FreeBlock
+    {
+        FreeBlock *next;
+    };
+
+    FreeBlock *freeList = nullptr;
+    std::vector<std::unique_ptr<char[]>> chunks;
+    size_t largestFrame = 0;
+    size_t oversized = 0;
+
+    void addChunk()
+    {
+        chunks.push_back(std::make_unique<char[]>(blockSize * blocksPerChunk));
+        char *chunk = chunks.back().get();
+        for (size_t i = blocksPerChunk; i-- > 0;)
+        {
+            FreeBlock *block = reinterpret_cast<FreeBlock *>(chunk + i * blockSize);
+            block->next = freeList;
+            freeList = block;
+        }
+    }
+
+    void reserve(size_t blocks)
+    {
+        while (chunks.size() * blocksPerChunk < blocks)
+            addChunk();
+    }
+
+    void *allocate(size_t size)
+    {
+        largestFrame = std::max(largestFrame, size);
+        if (size > blockSize)
+        {
+            oversized++;
+            return ::operator new(size);
+        }
+        if (!freeList)
+            addChunk();
+        FreeBlock *block = freeList;
+        freeList = block->next;
+        return block;
+    }
+
+    void deallocate(void *frame, size_t size)
+    {
+        if (size > blockSize)
+        {
+            ::operator delete(frame);
+            return;
+        }
+        FreeBlock *block = static_cast<FreeBlock *>(frame);
+        block->next = freeList;
+        freeList = block;
+    }
+}
+
+struct Sleep
+{
+    float seconds;
+};
+
+static Sleep sleepFor(float seconds)
+{
+    return Sleep{seconds};
+}
+
+// Runs up to its first sleep when created, every resume() runs it to the
+// next one. co_await sleepFor() hands back the agent it drives.
+class Behavior
+{
+public:
+    struct promise_type
+    {
+        Agent *self = nullptr;
+        float delay = -1.0f;
+
+        Behavior get_return_object() { return Behavior(std::coroutine_handle<promise_type>::from_promise(*this)); }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+        void return_void() { delay = -1.0f; }
+        void unhandled_exception() { std::terminate(); }
+
+        struct Awaiter
+        {
+            promise_type *promise;
+            float seconds;
+
+            bool await_ready() const noexcept { return false; }
+            void await_suspend(std::coroutine_handle<promise_type>) noexcept { promise->delay = seconds; }
+            Agent *await_resume() const noexcept { return promise->self; }
+        };
+
+        Awaiter await_transform(Sleep sleep) { return Awaiter{this, sleep.seconds}; }
+
+        static void *operator new(std::size_t size) { return FramePool::allocate(size); }
+        static void operator delete(void *frame, std::size_t size) { FramePool::deallocate(frame, size); }
+    };
+
+    Behavior(Behavior &&other) noexcept : handle(std::exchange(other.handle, nullptr)) {}
+    Behavior &operator=(Behavior &&) = delete;
+    ~Behavior()
+    {
+        if (handle)
+            handle.destroy();
+    }
+
+    // Seconds the behaviour asked to sleep, negative once it has returned
+    float getDelay() const { return handle && !handle.done() ? handle.promise().delay : -1.0f; }
+
+    // Run until the next sleep and return its length
+    float resume(Agent *self)
+    {
+        if (!handle || handle.done())
+            return -1.0f;
+        handle.promise().self = self;
+        handle.resume();
+        return getDelay();
+    }
+
+private:
+    std::coroutine_handle<promise_type> handle;
+
+    explicit Behavior(std::coroutine_handle<promise_type> h) : handle(h) {}
+};
+
+static float ticksToSeconds(int ticks)
+{
+    return ticks / tickRate;
+}
+
+static Behavior warden(int delay)
+{
+    Agent *self = co_await sleepFor(ticksToSeconds(delay));
+    for (;;)
+    {
+        for (int i = 0; i < advanceCount; i++)
+        {
+            self->vx = 0.0f;
+            self->vy = 40.0f;
+            self = co_await sleepFor(ticksToSeconds(advanceTicks));
+            self->vy = 0.0f;
+            self = co_await sleepFor(ticksToSeconds(restTicks));
+        }
+
+        self = co_await sleepFor(ticksToSeconds(chargeTicks));
+        self->vx = 120.0f;
+        self->vy = 60.0f;
+        self = co_await sleepFor(ticksToSeconds(dashTicks));
+
+        self->vx = 0.0f;
+        self->vy = 0.0f;
+        for (int i = 0; i < burstShots; i++)
+        {
+            self->shots++;
+            self = co_await sleepFor(ticksToSeconds(shotTicks));
+        }
+    }
+}
+
+static uint32_t toTicks(float seconds)
+{
+    return static_cast<uint32_t>(std::lround(seconds * tickRate));
+}
+
+// --- Driver ---
+
+static void move(std::vector<Agent> &agents)
+{
+    for (Agent &a : agents)
+    {
+        a.x += a.vx * dt;
+        a.y += a.vy * dt;
+    }
+}
+
+static uint64_t hashAgents(const std::vector<Agent> &agents)
+{
+    uint64_t hash = 14695981039346656037ULL;
+    for (const Agent &a : agents)
+    {
+        unsigned char bytes[sizeof(Agent)];
+        std::memcpy(bytes, &a, sizeof(Agent));
+        for (unsigned char b : bytes)
+        {
+            hash ^= b;
+            hash *= 1099511628211ULL;
+        }
+    }
+    return hash;
+}
+
+int main(int argc, char **argv)
+{
+    int ticks = argc > 1 ? std::atoi(argv[1]) : 1200;
+
+    std::cout << "ns per enemy per tick, speedup is the coroutine against the wheel-driven machine\n";
+    std::cout << std::setw(8) << "enemies" << std::setw(10) << "polled" << std::setw(10) << "wheel" << std::setw(10) << "coro"
+              << std::setw(10) << "speedup" << "  result\n";
+    bool allMatch = true;
+    // Up to the store's full capacity, and well past it
+    for (uint32_t count : {1000u, 8192u, 100000u})
+    {
+        // Machines are owned through base pointers, as enemies were before EnemyStore
+        std::vector<Agent> machineAgents(count);
+        std::vector<std::unique_ptr<Pattern>> machines;
+        for (uint32_t id = 0; id < count; id++)
+            machines.push_back(std::make_unique<WardenMachine>(startDelay(id)));
+
+        // Only the behaviour step is timed, moving the agents costs the same every way
+        double machineNs = 0.0;
+        for (int tick = 0; tick < ticks; tick++)
+        {
+            auto start = std::chrono::steady_clock::now();
+            for (uint32_t id = 0; id < count; id++)
+                machines[id]->tick(machineAgents[id]);
+            machineNs += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+            move(machineAgents);
+        }
+
+        // Machines stored by value and woken by the wheel, as EnemyStore does,
+        // with the due ones gathered first and woken as one batch
+        std::vector<Agent> timedAgents(count);
+        std::vector<WardenTimed> timed(count);
+        TimerWheel<uint32_t> timedWheel(count);
+        for (uint32_t id = 0; id < count; id++)
+            timedWheel.schedule(id, static_cast<uint32_t>(startDelay(id)));
+
+        std::vector<uint32_t> batch;
+        batch.reserve(count);
+        double timedNs = 0.0;
+        for (int tick = 0; tick < ticks; tick++)
+        {
+            auto start = std::chrono::steady_clock::now();
+            batch.clear();
+            timedWheel.advance([&](uint32_t id) { batch.push_back(id); });
+            for (uint32_t id : batch)
+            {
+                TimedPattern &pattern = timed[id];
+                int next = pattern.wake(timedAgents[id]);
+                if (next >= 0)
+                    timedWheel.schedule(id, static_cast<uint32_t>(next));
+            }
+            timedNs += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+            move(timedAgents);
+        }
+
+        std::vector<Agent> coroAgents(count);
+        std::vector<Behavior> behaviors;
+        behaviors.reserve(count);
+        TimerWheel<uint32_t> wheel(count);
+        FramePool::reserve(count);
+        for (uint32_t id = 0; id < count; id++)
+        {
+            behaviors.push_back(warden(startDelay(id)));
+            wheel.schedule(id, toTicks(behaviors[id].getDelay()));
+        }
+
+        // Batched the same way
+        double coroNs = 0.0;
+        for (int tick = 0; tick < ticks; tick++)
+        {
+            auto start = std::chrono::steady_clock::now();
+            batch.clear();
+            wheel.advance([&](uint32_t id) { batch.push_back(id); });
+            for (uint32_t id : batch)
+            {
+                float next = behaviors[id].resume(&coroAgents[id]);
+                if (next >= 0.0f)
+                    wheel.schedule(id, toTicks(next));
+            }
+            coroNs += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+            move(coroAgents);
+        }
+
+        uint64_t expected = hashAgents(machineAgents);
+        bool match = hashAgents(timedAgents) == expected && hashAgents(coroAgents) == expected;
+        allMatch = allMatch && match;
+
+        double perEnemy = static_cast<double>(ticks) * count;
+        std::cout << std::setw(8) << count << std::fixed << std::setprecision(2) << std::setw(10) << machineNs / perEnemy
+                  << std::setw(10) << timedNs / perEnemy << std::setw(10) << coroNs / perEnemy << std::setw(9) << timedNs / coroNs
+                  << "x  " << (match ? "identical" : "MISMATCH") << "\n";
+    }
+
+    // Starting a behaviour takes a block from the pool once it has grown
+    size_t chunksBefore = FramePool::chunks.size();
+    const int churn = 100000;
+    auto churnStart = std::chrono::steady_clock::now();
+    for (int i = 0; i < churn; i++)
+    {
+        Behavior b = warden(startDelay(i));
+        (void)b;
+    }
+    auto churnEnd = std::chrono::steady_clock::now();
+
+    std::cout << "\nFrame size:      " << FramePool::largestFrame << " bytes (block " << FramePool::blockSize << ")\n";
+    std::cout << "Start and drop:  " << std::setprecision(1)
+              << std::chrono::duration<double, std::nano>(churnEnd - churnStart).count() / churn << " ns per behaviour, "
+              << FramePool::chunks.size() - chunksBefore << " new chunks, " << FramePool::oversized << " oversized frames\n";
+    return allMatch ? 0 : 1;
+}
@@ -0,0 +1,61 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "../include/BulletKernels.hpp"
+
+// Throughput of the bullet integration kernel for each instruction set tier
+// Usage: bench_bullet_kernels [bullets] [passes]
+int main(int argc, char **argv)
+{
+    size_t count = argc > 1 ? static_cast<size_t>(std::atol(argv[1])) : 4096;
+    int passes = argc > 2 ? std::atoi(argv[2]) : 20000;
+
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> pos(0.0f, 1000.0f), vel(-800.0f, 800.0f);
+
+    std::vector<float> x0(count), y0(count), vx(count), vy(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        x0[i] = pos(rng);
+        y0[i] = pos(rng);
+        vx[i] = vel(rng);
+        vy[i] = vel(rng);
+    }
+
+    // Tiny dt keeps bullets near their start so every pass does the same work
+    const float dt = 1e-7f;
+    const WallBounds bounds = {100.0f, 900.0f, 100.0f, 900.0f};
+    std::vector<unsigned char> mask(count);
+    std::vector<unsigned char> referenceMask;
+
+    std::cout << "Bullets: " << count << ", passes: " << passes << "\n";
+    std::cout << std::setw(8) << "tier" << std::setw(14) << "ns/pass" << std::setw(16) << "bullets/ns" << "\n";
+
+    for (SimdTier tier : {SimdTier::Scalar, SimdTier::SSE2, SimdTier::AVX2})
+    {
+        if (!isSimdTierSupported(tier))
+        {
+            std::cout << std::setw(8) << getSimdTierName(tier) << "  unsupported on this CPU\n";
+            continue;
+        }
+
+        std::vector<float> x = x0, y = y0;
+        auto start = std::chrono::steady_clock::now();
+        for (int p = 0; p < passes; p++)
+            integrateBullets(tier, x.data(), y.data(), vx.data(), vy.data(), count, dt, bounds, mask.data());
+        auto end = std::chrono::steady_clock::now();
+
+        double ns = std::chrono::duration<double, std::nano>(end - start).count() / passes;
+        std::cout << std::setw(8) << getSimdTierName(tier) << std::setw(14) << std::fixed << std::setprecision(1) << ns
+                  << std::setw(16) << std::setprecision(3) << count / ns;
+
+        // Every tier must flag the same walls
+        if (referenceMask.empty()) referenceMask = mask;
+        else if (mask != referenceMask) std::cout << "  MASK MISMATCH";
+        std::cout << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,112 @@
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "../include/SpatialGrid.hpp"
+
+// Compares the old nested bullet-vs-enemy loop with the SpatialGrid broadphase
+// Usage: bench_collision [frames]
+
+struct Body
+{
+    sf::Vector2f pos;
+    float radius;
+};
+
+static void makeScene(int count, std::vector<Body> &enemies, std::vector<Body> &bullets)
+{
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> x(0.0f, 1920.0f), y(0.0f, 1080.0f);
+    const float enemyRadii[] = {15.0f, 10.0f, 18.0f, 50.0f};
+
+    enemies.clear();
+    bullets.clear();
+    for (int i = 0; i < count; i++)
+    {
+        if (i % 2 == 0) enemies.push_back({{x(rng), y(rng)}, enemyRadii[(i / 2) % 4]});
+        else bullets.push_back({{x(rng), y(rng)}, 8.0f});
+    }
+}
+
+// Same shape as the original loop in main.cpp
+static int nestedLoop(const std::vector<Body> &enemies, const std::vector<Body> &bullets)
+{
+    int hits = 0;
+    for (const Body &e : enemies)
+    {
+        for (const Body &b : bullets)
+        {
+            float dist = std::sqrt(std::pow(e.pos.x - b.pos.x, 2) + std::pow(e.pos.y - b.pos.y, 2));
+            if (dist < e.radius + b.radius)
+            {
+                hits++;
+                break;
+            }
+        }
+    }
+    return hits;
+}
+
+static int gridQuery(SpatialGrid &grid, const std::vector<Body> &enemies, const std::vector<Body> &bullets)
+{
+    grid.clear();
+    for (size_t i = 0; i < bullets.size(); i++)
+        grid.insert(static_cast<int>(i), bullets[i].pos, bullets[i].radius);
+    grid.build();
+
+    int hits = 0;
+    for (const Body &e : enemies)
+    {
+        bool hit = false;
+        grid.query(e.pos, e.radius, [&](int id)
+        {
+            sf::Vector2f d = bullets[id].pos - e.pos;
+            float reach = e.radius + bullets[id].radius;
+            if (d.x * d.x + d.y * d.y < reach * reach)
+                hit = true;
+        });
+        if (hit) hits++;
+    }
+    return hits;
+}
+
+template <typename F>
+static double timeFrames(int frames, F &&frame, int &hits)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < frames; i++)
+        hits = frame();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>(end - start).count() / frames;
+}
+
+int main(int argc, char **argv)
+{
+    int frames = argc > 1 ? std::atoi(argv[1]) : 200;
+    SpatialGrid grid(sf::Vector2f(1920.0f, 1080.0f));
+    std::vector<Body> enemies, bullets;
+
+    std::cout << std::setw(10) << "entities" << std::setw(16) << "nested us/frm" << std::setw(16) << "grid us/frm"
+              << std::setw(10) << "speedup" << std::setw(8) << "hits" << "\n";
+
+    for (int count : {100, 1000, 10000})
+    {
+        makeScene(count, enemies, bullets);
+
+        // The quadratic loop gets fewer frames at large counts to keep runs short
+        int nestedFrames = count >= 10000 ? std::max(1, frames / 20) : frames;
+        int nestedHits = 0, gridHits = 0;
+        double nested = timeFrames(nestedFrames, [&] { return nestedLoop(enemies, bullets); }, nestedHits);
+        double gridded = timeFrames(frames, [&] { return gridQuery(grid, enemies, bullets); }, gridHits);
+
+        std::cout << std::setw(10) << count << std::setw(16) << std::fixed << std::setprecision(2) << nested
+                  << std::setw(16) << gridded << std::setw(9) << nested / gridded << "x" << std::setw(8) << gridHits;
+        if (nestedHits != gridHits)
+            std::cout << "  MISMATCH (nested " << nestedHits << ")";
+        std::cout << "\n";
+    }
+    return 0;
+}
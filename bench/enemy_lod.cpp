@@ -0,0 +1,78 @@
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+#include "../include/Simulation.hpp"
+#include "../include/Rng.hpp"
+
+// Step cost with a fixed number of enemies near the window and a growing
+// crowd far outside it, with the enemy LOD on and off
+// Usage: bench_enemy_lod [ticks] [workers]
+
+const int worldW = 3840, worldH = 2160;
+const int visibleCount = 1000;
+
+static double run(int farCount, int ticks, unsigned workers, bool lod, size_t &farSeen)
+{
+    Simulation sim(worldW, worldH, 60.0f, workers);
+    sim.reset(675.0f, 42);
+    sim.skipCollapseAnimation();
+    sim.setEnemyLodEnabled(lod);
+
+    EnemyStore &enemies = sim.getEnemies();
+    enemies.setCapacity(visibleCount + farCount);
+    const PlayingWindow &window = sim.getWindow();
+
+    Rng rng(7);
+    for (int i = 0; i < visibleCount; i++)
+    {
+        sf::Vector2f pos(window.getLeft() + rng.nextFloat() * window.getWidth(), window.getTop() + rng.nextFloat() * window.getHeight());
+        if (i % 4 == 0) enemies.spawn<Square>(pos);
+        else enemies.spawn<Triangle>(pos);
+    }
+
+    // Far enough out that none reach the window during the run
+    for (int placed = 0; placed < farCount;)
+    {
+        sf::Vector2f pos(rng.nextFloat() * worldW, rng.nextFloat() * worldH);
+        if (pos.x > window.getLeft() - 800.0f && pos.x < window.getRight() + 800.0f &&
+            pos.y > window.getTop() - 800.0f && pos.y < window.getBottom() + 800.0f)
+            continue;
+        if (placed % 4 == 0) enemies.spawn<Square>(pos);
+        else enemies.spawn<Triangle>(pos);
+        placed++;
+    }
+
+    InputFrame input;
+    input.aimPos = sf::Vector2f(0.0f, 0.0f);
+    input.fire = true;
+    float dt = sim.getTickDuration();
+
+    auto start = std::chrono::steady_clock::now();
+    for (int tick = 0; tick < ticks; tick++)
+        sim.step(dt, input);
+    auto end = std::chrono::steady_clock::now();
+
+    farSeen = sim.getFarEnemyCount();
+    return std::chrono::duration<double, std::milli>(end - start).count() / ticks;
+}
+
+int main(int argc, char **argv)
+{
+    int ticks = argc > 1 ? std::atoi(argv[1]) : 120;
+    unsigned workers = argc > 2 ? static_cast<unsigned>(std::atoi(argv[2])) : JobSystem::getDefaultWorkerCount();
+
+    std::cout << visibleCount << " enemies in the window, " << workers << " workers\n";
+    std::cout << std::left << std::setw(12) << "far enemies" << std::setw(16) << "full ms/tick"
+              << std::setw(16) << "LOD ms/tick" << std::setw(10) << "speedup" << "on reduced rate\n";
+    for (int farCount : {0, 4000, 16000, 64000})
+    {
+        size_t unused = 0, farSeen = 0;
+        double full = run(farCount, ticks, workers, false, unused);
+        double lod = run(farCount, ticks, workers, true, farSeen);
+        std::cout << std::left << std::setw(12) << farCount << std::fixed << std::setprecision(3)
+                  << std::setw(16) << full << std::setw(16) << lod << std::setw(10) << full / lod << farSeen << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,77 @@
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "../include/Simulation.hpp"
+#include "../include/Rng.hpp"
+
+// Steps a crowded simulation on one thread and on the job system, and checks
+// both end in the same state
+// Usage: bench_enemy_update [ticks] [workers]
+
+struct Result
+{
+    double msPerTick;
+    uint64_t checksum;
+};
+
+static Result run(int enemyCount, int ticks, unsigned workers)
+{
+    Simulation sim(1920, 1080, 60.0f, workers);
+    sim.reset(1080.0f, 42);
+    sim.skipCollapseAnimation();
+
+    // Every type, Spikers included so shot merging is exercised
+    Rng rng(7);
+    EnemyStore &enemies = sim.getEnemies();
+    enemies.setCapacity(enemyCount);
+    for (int i = 0; i < enemyCount; i++)
+    {
+        sf::Vector2f pos(static_cast<float>(rng.nextInt(1920)), static_cast<float>(rng.nextInt(1080)));
+        switch (i % 16)
+        {
+        case 0: enemies.spawn<Spiker>(pos); break;
+        case 1: case 2: case 3: case 4: enemies.spawn<Square>(pos); break;
+        case 5: case 6: case 7: case 8: case 9: enemies.spawn<Circle>(pos); break;
+        default: enemies.spawn<Triangle>(pos); break;
+        }
+    }
+
+    InputFrame input;
+    input.aimPos = sf::Vector2f(0.0f, 0.0f);
+    float dt = sim.getTickDuration();
+
+    auto start = std::chrono::steady_clock::now();
+    for (int tick = 0; tick < ticks; tick++)
+        sim.step(dt, input);
+    auto end = std::chrono::steady_clock::now();
+
+    return {std::chrono::duration<double, std::milli>(end - start).count() / ticks, sim.getChecksum()};
+}
+
+int main(int argc, char **argv)
+{
+    int ticks = argc > 1 ? std::atoi(argv[1]) : 120;
+    unsigned workers = argc > 2 ? static_cast<unsigned>(std::atoi(argv[2])) : JobSystem::getDefaultWorkerCount();
+
+    std::cout << "Workers: " << workers << " (plus the calling thread)\n";
+    std::cout << std::left << std::setw(10) << "enemies" << std::setw(16) << "serial ms/tick"
+              << std::setw(16) << "jobs ms/tick" << std::setw(10) << "speedup" << "result\n";
+
+    bool allMatch = true;
+    for (int count : {1000, 10000, 50000})
+    {
+        Result serial = run(count, ticks, 0);
+        Result parallel = run(count, ticks, workers);
+        bool match = serial.checksum == parallel.checksum;
+        allMatch = allMatch && match;
+
+        std::cout << std::left << std::setw(10) << count << std::fixed << std::setprecision(3)
+                  << std::setw(16) << serial.msPerTick << std::setw(16) << parallel.msPerTick
+                  << std::setw(10) << serial.msPerTick / parallel.msPerTick
+                  << (match ? "identical" : "MISMATCH") << "\n";
+    }
+    return allMatch ? 0 : 1;
+}
@@ -0,0 +1,117 @@
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "../include/FlowField.hpp"
+#include "../include/Rng.hpp"
+
+// Steering cost per enemy: the old per-enemy sqrt and atan2 against one flow
+// field lookup, with the field moving every tick as if the player never
+// stayed in one cell. Below one enemy per two cells the field is not rebuilt and
+// each sample works out its own cell. Then the cost of one field update when
+// the player changes cell, against a wall crossing a cell boundary.
+// Usage: bench_flow_field [ticks]
+
+struct Steer
+{
+    sf::Vector2f direction;
+    float angle;
+};
+
+// What every enemy update used to do
+static Steer directMath(sf::Vector2f pos, sf::Vector2f playerPos)
+{
+    sf::Vector2f dir = playerPos - pos;
+    float len = std::sqrt(dir.x * dir.x + dir.y * dir.y);
+    sf::Vector2f normDir = (len != 0) ? dir / len : sf::Vector2f(0, 0);
+    return {normDir, std::atan2(normDir.y, normDir.x) * 180.0f / 3.14159f};
+}
+
+int main(int argc, char **argv)
+{
+    int ticks = argc > 1 ? std::atoi(argv[1]) : 200;
+    const WallBounds walls = {300.0f, 1620.0f, 100.0f, 980.0f};
+
+    std::cout << std::setw(8) << "enemies" << std::setw(14) << "direct ns" << std::setw(14) << "field ns" << std::setw(10) << "speedup" << "\n";
+    const int counts[] = {100, 250, 500, 1000, 10000, 50000};
+    for (int count : counts)
+    {
+        Rng rng(3);
+        std::vector<sf::Vector2f> enemies(count);
+        for (sf::Vector2f &e : enemies)
+            e = sf::Vector2f(rng.nextFloat() * 1920.0f, rng.nextFloat() * 1080.0f);
+
+        // Player walks a circle large enough to change cell every tick
+        auto playerAt = [](int tick)
+        {
+            float a = tick * 0.25f;
+            return sf::Vector2f(960.0f + std::cos(a) * 300.0f, 540.0f + std::sin(a) * 300.0f);
+        };
+
+        float sink = 0.0f;
+        auto start = std::chrono::steady_clock::now();
+        for (int tick = 0; tick < ticks; tick++)
+        {
+            sf::Vector2f playerPos = playerAt(tick);
+            for (const sf::Vector2f &e : enemies)
+            {
+                Steer s = directMath(e, playerPos);
+                sink += s.direction.x + s.angle;
+            }
+        }
+        auto mid = std::chrono::steady_clock::now();
+
+        FlowField field(sf::Vector2f(1920.0f, 1080.0f));
+        for (int tick = 0; tick < ticks; tick++)
+        {
+            field.update(playerAt(tick), walls, enemies.size());
+            for (const sf::Vector2f &e : enemies)
+            {
+                FlowField::Sample s = field.sample(e);
+                sink += s.direction.x + s.angle;
+            }
+        }
+        auto end = std::chrono::steady_clock::now();
+
+        double samples = static_cast<double>(ticks) * count;
+        double direct = std::chrono::duration<double, std::nano>(mid - start).count() / samples;
+        double flow = std::chrono::duration<double, std::nano>(end - mid).count() / samples;
+        std::cout << std::setw(8) << count << std::fixed << std::setprecision(2)
+                  << std::setw(14) << direct << std::setw(14) << flow << std::setw(9) << direct / flow << "x"
+                  << (sink == 12345.0f ? " " : "") << "\n";
+    }
+
+    // Update cost alone, with enough enemies that the field is kept. The
+    // player steps one cell per tick, or stands still while the walls
+    // breathe, crossing a cell boundary every tick.
+    std::cout << "\n" << std::setw(16) << "update" << std::setw(14) << "ns/update" << std::setw(14) << "cells/update" << "\n";
+    const size_t samplers = 100000;
+    for (bool wallsOnly : {false, true})
+    {
+        FlowField field(sf::Vector2f(1920.0f, 1080.0f));
+        field.update(sf::Vector2f(960.0f, 540.0f), walls, samplers);
+        size_t cellsBefore = field.getUpdatedCellCount();
+        auto start = std::chrono::steady_clock::now();
+        for (int tick = 0; tick < ticks; tick++)
+        {
+            float step = static_cast<float>(tick % 8 < 4 ? tick % 8 : 8 - tick % 8) * 64.0f;
+            if (wallsOnly)
+            {
+                WallBounds moved = {walls.left + step, walls.right - step, walls.top + step / 2.0f, walls.bottom - step / 2.0f};
+                field.update(sf::Vector2f(960.0f, 540.0f), moved, samplers);
+            }
+            else
+            {
+                field.update(sf::Vector2f(640.0f + step, 540.0f), walls, samplers);
+            }
+        }
+        auto end = std::chrono::steady_clock::now();
+        std::cout << std::setw(16) << (wallsOnly ? "wall moved" : "player moved") << std::fixed << std::setprecision(0)
+                  << std::setw(14) << std::chrono::duration<double, std::nano>(end - start).count() / ticks << std::setw(14)
+                  << static_cast<double>(field.getUpdatedCellCount() - cellsBefore) / ticks << "\n";
+    }
+    return 0;
+}
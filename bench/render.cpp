@@ -0,0 +1,122 @@
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "../include/BatchRenderer.hpp"
+#include "../include/BulletPool.hpp"
+#include "../include/Enemy.hpp"
+#include "../include/Player.hpp"
+
+// Draw time of per-shape rendering against the batch renderer, drawn into an
+// offscreen render texture so it runs without a visible window.
+// Usage: bench_render [frames]
+
+// One entity drawn the way Entity::draw used to: a shape and a draw call per part
+static int drawWithShapes(sf::RenderTarget &target, sf::Vector2f pos, float radius, float rotation, sf::Color color,
+                          const std::vector<Barrel> &barrels)
+{
+    int calls = 0;
+    for (const auto &b : barrels)
+    {
+        sf::RectangleShape barrelShape(sf::Vector2f(b.length, b.width));
+        barrelShape.setOrigin(sf::Vector2f(0.0f, b.width / 2.0f));
+        barrelShape.setFillColor(sf::Color(153, 153, 153));
+        barrelShape.setOutlineThickness(2.0f);
+        barrelShape.setOutlineColor(sf::Color(85, 85, 85));
+
+        float totalAngle = rotation + b.angle;
+        float radAngle = totalAngle * 3.14159f / 180.0f;
+        sf::Vector2f forward(std::cos(radAngle), std::sin(radAngle));
+        sf::Vector2f right(-forward.y, forward.x);
+        barrelShape.setPosition(pos + right * b.offset);
+        barrelShape.setRotation(sf::degrees(totalAngle));
+        target.draw(barrelShape);
+        calls++;
+    }
+
+    sf::CircleShape body(radius);
+    body.setOrigin(sf::Vector2f(radius, radius));
+    body.setPosition(pos);
+    body.setFillColor(color);
+    body.setOutlineThickness(3.0f);
+    body.setOutlineColor(sf::Color(85, 85, 85));
+    target.draw(body);
+    return calls + 1;
+}
+
+int main(int argc, char **argv)
+{
+    int frames = argc > 1 ? std::atoi(argv[1]) : 120;
+
+    sf::RenderTexture target;
+    if (!target.resize({1920, 1080}))
+    {
+        std::cout << "Could not create an offscreen render target on this machine\n";
+        return 1;
+    }
+
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> x(0.0f, 1920.0f), y(0.0f, 1080.0f), vel(-400.0f, 400.0f);
+
+    std::cout << std::setw(10) << "entities" << std::setw(16) << "shapes ms/frm" << std::setw(14) << "draw calls"
+              << std::setw(16) << "batch ms/frm" << std::setw(14) << "vertices" << "\n";
+
+    for (int count : {100, 1000, 10000})
+    {
+        // Half bullets, half enemies of every type, plus a Gunner player
+        BulletPool bullets(count, BulletOwner::Player);
+        std::vector<Triangle> triangles;
+        std::vector<Spiker> spikers;
+        for (int i = 0; i < count / 2; i++)
+            bullets.spawn({x(rng), y(rng)}, {vel(rng), vel(rng)}, BulletSink::bulletRadius, 10, BulletOwner::Player);
+        for (int i = 0; i < count / 2; i++)
+        {
+            if (i % 50 == 0) spikers.emplace_back(sf::Vector2f(x(rng), y(rng)));
+            else triangles.emplace_back(sf::Vector2f(x(rng), y(rng)));
+        }
+        Player player(15.0f, 5.0f, 960.0f, 540.0f);
+        player.setTank(TankId::Gunner);
+
+        const std::vector<Barrel> noBarrels;
+
+        int drawCalls = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int f = 0; f < frames; f++)
+        {
+            drawCalls = 0;
+            target.clear();
+            for (const Triangle &t : triangles)
+                drawCalls += drawWithShapes(target, t.getPosition(), t.getRadius(), t.getRotation(), sf::Color::Yellow, t.getBarrels());
+            for (const Spiker &s : spikers)
+                drawCalls += drawWithShapes(target, s.getPosition(), s.getRadius(), s.getRotation(), sf::Color(50, 50, 50), s.getBarrels());
+            for (size_t i = 0; i < bullets.size(); i++)
+                drawCalls += drawWithShapes(target, bullets.getPosition(i), bullets.radius[i], 0.0f, sf::Color::Yellow, noBarrels);
+            drawCalls += drawWithShapes(target, player.getPosition(), player.getRadius(), player.getRotation(), sf::Color(0, 178, 225), player.getBarrels());
+            target.display();
+        }
+        double shapesMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / frames;
+
+        BatchRenderer batch;
+        size_t vertices = 0;
+        start = std::chrono::steady_clock::now();
+        for (int f = 0; f < frames; f++)
+        {
+            target.clear();
+            for (const Triangle &t : triangles) t.draw(batch);
+            for (const Spiker &s : spikers) s.draw(batch);
+            bullets.draw(batch);
+            player.draw(batch);
+            vertices = batch.getVertexCount();
+            batch.flush(target);
+            target.display();
+        }
+        double batchMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / frames;
+
+        std::cout << std::setw(10) << count << std::setw(16) << std::fixed << std::setprecision(3) << shapesMs
+                  << std::setw(14) << drawCalls << std::setw(16) << batchMs << std::setw(14) << vertices << "\n";
+    }
+    return 0;
+}
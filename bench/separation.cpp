@@ -0,0 +1,108 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "../include/Separation.hpp"
+#include "../include/Rng.hpp"
+
+// Enemy separation cost: every pair tested against the grid neighbour query,
+// on swarms packed around the player the way a long run ends up
+// Usage: bench_separation [ticks]
+
+struct Body
+{
+    sf::Vector2f pos;
+    float radius;
+};
+
+// The brute force version, same push rule as Separation::solve
+static void naivePushes(const std::vector<Body> &bodies, std::vector<sf::Vector2f> &pushes)
+{
+    const float goldenAngle = 2.39996323f;
+    for (size_t i = 0; i < bodies.size(); i++)
+    {
+        sf::Vector2f push(0.0f, 0.0f);
+        for (size_t j = 0; j < bodies.size(); j++)
+        {
+            if (j == i)
+                continue;
+            sf::Vector2f d = bodies[i].pos - bodies[j].pos;
+            float reach = bodies[i].radius + bodies[j].radius;
+            float dist2 = d.x * d.x + d.y * d.y;
+            if (dist2 >= reach * reach)
+                continue;
+
+            float share = bodies[j].radius / reach;
+            if (dist2 == 0.0f)
+            {
+                float angle = static_cast<float>(i) * goldenAngle;
+                push += sf::Vector2f(std::cos(angle), std::sin(angle)) * share;
+                continue;
+            }
+            float dist = std::sqrt(dist2);
+            push += d * ((1.0f - dist / reach) * share / dist);
+        }
+        pushes[i] = push;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    int ticks = argc > 1 ? std::atoi(argv[1]) : 50;
+    const sf::Vector2f world(1920.0f, 1080.0f);
+
+    std::cout << std::setw(8) << "enemies" << std::setw(14) << "naive us" << std::setw(14) << "grid us" << std::setw(10) << "speedup"
+              << std::setw(12) << "max diff" << "\n";
+    const int counts[] = {250, 1000, 2000, 5000};
+    for (int count : counts)
+    {
+        // Mostly triangles with some circles and squares, crowded towards the centre
+        Rng rng(7);
+        std::vector<Body> bodies(count);
+        for (Body &b : bodies)
+        {
+            float angle = rng.nextFloat() * 6.2831853f;
+            float dist = std::sqrt(rng.nextFloat()) * 500.0f;
+            b.pos = sf::Vector2f(960.0f + std::cos(angle) * dist, 540.0f + std::sin(angle) * dist);
+            float roll = rng.nextFloat();
+            b.radius = roll < 0.5f ? 15.0f : roll < 0.75f ? 10.0f : 20.0f;
+        }
+
+        // The naive version is too slow to run as often at the larger sizes
+        int naiveTicks = std::max(1, ticks * 250 / count);
+        std::vector<sf::Vector2f> expected(count);
+        auto start = std::chrono::steady_clock::now();
+        for (int tick = 0; tick < naiveTicks; tick++)
+            naivePushes(bodies, expected);
+        auto mid = std::chrono::steady_clock::now();
+
+        Separation separation(world);
+        for (int tick = 0; tick < ticks; tick++)
+        {
+            separation.clear();
+            for (const Body &b : bodies)
+                separation.add(b.pos, b.radius);
+            separation.build();
+            separation.solve(0, separation.size());
+        }
+        auto end = std::chrono::steady_clock::now();
+
+        float maxDiff = 0.0f;
+        for (int i = 0; i < count; i++)
+        {
+            sf::Vector2f d = separation.getPush(i) - expected[i];
+            maxDiff = std::max(maxDiff, std::abs(d.x) + std::abs(d.y));
+        }
+
+        double naive = std::chrono::duration<double, std::micro>(mid - start).count() / naiveTicks;
+        double grid = std::chrono::duration<double, std::micro>(end - mid).count() / ticks;
+        std::cout << std::setw(8) << count << std::fixed << std::setprecision(1)
+                  << std::setw(14) << naive << std::setw(14) << grid << std::setw(9) << naive / grid << "x"
+                  << std::scientific << std::setprecision(1) << std::setw(12) << maxDiff << std::defaultfloat << "\n";
+    }
+    return 0;
+}
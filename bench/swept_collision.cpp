@@ -0,0 +1,113 @@
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "../include/Collision.hpp"
+#include "../include/Rng.hpp"
+
+// Hit registration of the old end-of-tick overlap test against the swept
+// test at falling tick rates, plus the cost of one test of each kind
+// Usage: bench_swept_collision [shots]
+
+struct Shot
+{
+    sf::Vector2f start;
+    sf::Vector2f velocity;
+    sf::Vector2f target;
+    sf::Vector2f targetVelocity;
+};
+
+// Fastest player bullet and the smallest enemy
+const float bulletRadius = 8.0f;
+const float bulletSpeed = 800.0f + 50.0f * 7.0f;
+const float targetRadius = 10.0f;
+
+static std::vector<Shot> makeShots(int count)
+{
+    Rng rng(99);
+    std::vector<Shot> shots;
+    for (int i = 0; i < count; i++)
+    {
+        // Aimed within the target radius from up to 400px away, target drifting
+        Shot s;
+        s.target = sf::Vector2f(960.0f, 540.0f);
+        s.start = s.target - sf::Vector2f(100.0f + 300.0f * rng.nextFloat(), 0.0f);
+        float miss = (rng.nextFloat() * 2.0f - 1.0f) * targetRadius;
+        s.velocity = sf::Vector2f(bulletSpeed, 0.0f);
+        s.start.y += miss;
+        s.targetVelocity = sf::Vector2f(0.0f, (rng.nextFloat() * 2.0f - 1.0f) * 60.0f);
+        shots.push_back(s);
+    }
+    return shots;
+}
+
+// Steps one shot until the bullet is well past the target
+static bool simulate(const Shot &s, float dt, bool swept)
+{
+    sf::Vector2f b = s.start, t = s.target;
+    for (int tick = 0; tick < 10000 && b.x < s.target.x + 200.0f; tick++)
+    {
+        sf::Vector2f b1 = b + s.velocity * dt;
+        sf::Vector2f t1 = t + s.targetVelocity * dt;
+
+        if (swept)
+        {
+            if (Collision::sweptCircles(b, b1, bulletRadius, t, t1, targetRadius) != Collision::noHit)
+                return true;
+        }
+        else
+        {
+            sf::Vector2f d = b1 - t1;
+            float reach = bulletRadius + targetRadius;
+            if (d.x * d.x + d.y * d.y < reach * reach)
+                return true;
+        }
+        b = b1;
+        t = t1;
+    }
+    return false;
+}
+
+int main(int argc, char **argv)
+{
+    int count = argc > 1 ? std::atoi(argv[1]) : 20000;
+    std::vector<Shot> shots = makeShots(count);
+
+    std::cout << count << " shots at a drifting target per tick rate\n\n";
+    std::cout << std::setw(10) << "tick rate" << std::setw(12) << "discrete" << std::setw(12) << "swept" << "\n";
+    const float tickRates[] = {120.0f, 60.0f, 30.0f, 20.0f, 15.0f, 10.0f};
+    for (float rate : tickRates)
+    {
+        int discreteHits = 0, sweptHits = 0;
+        for (const Shot &s : shots)
+        {
+            discreteHits += simulate(s, 1.0f / rate, false);
+            sweptHits += simulate(s, 1.0f / rate, true);
+        }
+        std::cout << std::setw(10) << static_cast<int>(rate) << std::setw(11) << std::fixed << std::setprecision(1) << 100.0 * discreteHits / count << "%"
+                  << std::setw(11) << 100.0 * sweptHits / count << "%\n";
+    }
+
+    // Raw cost of the narrow phase tests
+    const int repeats = 200;
+    volatile float sink = 0.0f;
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; r++)
+        for (const Shot &s : shots)
+        {
+            sf::Vector2f d = s.start - s.target;
+            sink = sink + (d.x * d.x + d.y * d.y < 18.0f * 18.0f ? 1.0f : 0.0f);
+        }
+    auto mid = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; r++)
+        for (const Shot &s : shots)
+            sink = sink + Collision::sweptCircles(s.start, s.start + s.velocity / 60.0f, bulletRadius, s.target, s.target + s.targetVelocity / 60.0f, targetRadius);
+    auto end = std::chrono::steady_clock::now();
+
+    double tests = static_cast<double>(repeats) * count;
+    std::cout << "\nOverlap test: " << std::chrono::duration<double, std::nano>(mid - start).count() / tests << " ns\n";
+    std::cout << "Swept test:   " << std::chrono::duration<double, std::nano>(end - mid).count() / tests << " ns\n";
+    return 0;
+}
@@ -0,0 +1,93 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "../include/TimerWheel.hpp"
+#include "../include/Rng.hpp"
+
+// Behaviour timers the old way, every entity counting down its own timer each
+// tick, against the timer wheel waking only the entities that are due.
+// Timers rearm with the 0.3 to 2 second periods the enemies use.
+// Usage: bench_timer_wheel [ticks]
+
+const uint32_t periods[] = {18, 30, 48, 60, 120};
+
+static uint32_t periodOf(uint32_t id, uint32_t wakes)
+{
+    return periods[(id + wakes) % 5];
+}
+
+// Fires are summed through a mixer, so both sides must wake the same
+// entities on the same ticks. Order within a tick may differ.
+static uint64_t fireHash(uint32_t id, int tick)
+{
+    uint64_t x = (static_cast<uint64_t>(tick) << 32) | id;
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    return x;
+}
+
+int main(int argc, char **argv)
+{
+    int ticks = argc > 1 ? std::atoi(argv[1]) : 3600;
+
+    std::cout << std::setw(8) << "timers" << std::setw(14) << "polled ns" << std::setw(14) << "wheel ns" << std::setw(10) << "speedup"
+              << std::setw(14) << "fired/tick" << "  result\n";
+    bool allMatch = true;
+    for (uint32_t count : {1000u, 10000u, 100000u})
+    {
+        Rng rng(5);
+        std::vector<uint32_t> firstDelay(count);
+        for (uint32_t &d : firstDelay)
+            d = 1 + static_cast<uint32_t>(rng.nextInt(120));
+
+        uint64_t polledHash = 0, wheelHash = 0;
+        long fired = 0;
+
+        std::vector<uint32_t> remaining = firstDelay;
+        std::vector<uint32_t> wakes(count, 0);
+        auto start = std::chrono::steady_clock::now();
+        for (int tick = 1; tick <= ticks; tick++)
+        {
+            for (uint32_t id = 0; id < count; id++)
+            {
+                if (--remaining[id] != 0)
+                    continue;
+                polledHash += fireHash(id, tick);
+                remaining[id] = periodOf(id, ++wakes[id]);
+                fired++;
+            }
+        }
+        auto mid = std::chrono::steady_clock::now();
+
+        TimerWheel<uint32_t> wheel(count);
+        std::fill(wakes.begin(), wakes.end(), 0);
+        for (uint32_t id = 0; id < count; id++)
+            wheel.schedule(id, firstDelay[id]);
+        auto wheelStart = std::chrono::steady_clock::now();
+        for (int tick = 1; tick <= ticks; tick++)
+        {
+            wheel.advance([&](uint32_t id)
+            {
+                wheelHash += fireHash(id, tick);
+                wheel.schedule(id, periodOf(id, ++wakes[id]));
+            });
+        }
+        auto end = std::chrono::steady_clock::now();
+
+        bool match = polledHash == wheelHash;
+        allMatch = allMatch && match;
+
+        double polled = std::chrono::duration<double, std::nano>(mid - start).count() / ticks;
+        double wheeled = std::chrono::duration<double, std::nano>(end - wheelStart).count() / ticks;
+        std::cout << std::setw(8) << count << std::fixed << std::setprecision(0) << std::setw(14) << polled << std::setw(14) << wheeled
+                  << std::setprecision(2) << std::setw(9) << polled / wheeled << "x" << std::setprecision(1) << std::setw(14)
+                  << static_cast<double>(fired) / ticks << "  " << (match ? "identical" : "MISMATCH") << "\n";
+    }
+    return allMatch ? 0 : 1;
+}
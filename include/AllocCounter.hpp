@@ -0,0 +1,25 @@
+#pragma once
+#include <cstdint>
+
+// Counts calls to the global operator new so steady-state frames can be held
+// to an allocation budget. The hooks are only compiled in with
+// -DWINDOWSHOCK_COUNT_ALLOCS; without it every count reads zero.
+class AllocCounter
+{
+public:
+    static bool isEnabled();
+
+    // Allocations on any thread since startup
+    static uint64_t getTotal();
+
+    // Closes the current frame and returns how many allocations it made
+    static uint64_t endFrame();
+
+    // Leaves the current frame out of the budget, for run restarts and other one-off setup
+    static void skipFrame();
+
+    // Frames above the budget are counted from now on, negative turns it off
+    static void setBudget(int64_t allocationsPerFrame);
+    static uint64_t getFramesOverBudget();
+    static uint64_t getWorstFrame();
+};
@@ -0,0 +1,40 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <vector>
+
+// Collects filled circles and rotated rectangles, with their outlines, into a
+// single triangle list (a plain vertex array of sf::PrimitiveType::Triangles). Shapes keep the order they were added in, so one
+// flush() reproduces what per-shape window.draw calls used to produce.
+class BatchRenderer
+{
+private:
+    std::vector<sf::Vertex> vertices;
+
+    // Unit circle points for a few detail levels, small circles use fewer
+    struct CircleTable
+    {
+        std::vector<sf::Vector2f> points;
+    };
+    CircleTable circleTables[3];
+
+    const CircleTable &getCircleTable(float radius) const;
+
+    // Grow the batch by count vertices and return where to write them
+    sf::Vertex *allocate(size_t count);
+
+public:
+    BatchRenderer();
+
+    // Circle centred on center, outline grows outwards like sf::CircleShape
+    void addCircle(sf::Vector2f center, float radius, sf::Color fill, float outlineThickness, sf::Color outlineColor);
+
+    // Rectangle anchored at the middle of its left edge and rotated by angle degrees,
+    // matching an sf::RectangleShape with origin (0, height / 2)
+    void addRect(sf::Vector2f anchor, sf::Vector2f size, float angle, sf::Color fill, float outlineThickness, sf::Color outlineColor);
+
+    size_t getVertexCount() const { return vertices.size(); }
+
+    // Submit everything in one draw call and start a new batch
+    void flush(sf::RenderTarget &target);
+    void clear();
+};
@@ -0,0 +1,45 @@
+#pragma once
+#include <cstdint>
+#include "InputFrame.hpp"
+#include "Rng.hpp"
+#include "TankClass.hpp"
+
+class Simulation;
+
+// How a bot spends its points. The defaults are a balanced damage-first build
+// that picks its classes at random.
+struct BotBuild
+{
+    // Stats in the order points go into them, indices as in Player::statLevels
+    int statPriority[8] = {5, 6, 3, 1, 0, 7, 4, 2};
+    // Max out each stat before moving on instead of spreading points round robin
+    bool focus = false;
+
+    // Classes to take at tier 2 and 3, TankId::Count picks at random
+    TankId tier2 = TankId::Count;
+    TankId tier3 = TankId::Count;
+};
+
+// Scripted player for load tests. It keeps its distance from the nearest
+// enemy while shooting at it, strafes so it does not sit still, and spends
+// skill points and class upgrades as soon as they unlock. Everything it does
+// goes through InputFrame and Simulation::execute, so its runs can be
+// recorded and replayed like a human's.
+class Bot
+{
+private:
+    Rng rng;
+    BotBuild build;
+    float strafeTimer = 0.0f;
+    float strafeSign = 1.0f;
+    int nextStat = 0;
+
+public:
+    explicit Bot(uint64_t seed = 1, const BotBuild &build = BotBuild()) : rng(seed), build(build) {}
+
+    // Input for the next tick
+    InputFrame think(const Simulation &sim, float dt);
+
+    // Spend every skill point and take a class upgrade when one is available
+    void spendPoints(Simulation &sim);
+};
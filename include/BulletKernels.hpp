@@ -0,0 +1,47 @@
+#pragma once
+#include <cstddef>
+#include "BulletPool.hpp"
+
+// Instruction set used by the bullet kernels, picked once at startup
+enum class SimdTier
+{
+    Scalar,
+    SSE2,
+    AVX2
+};
+
+// One bit per wall, bit index matches PlayingWindow::hitWall
+enum WallBit : unsigned char
+{
+    WallLeft = 1 << 0,
+    WallRight = 1 << 1,
+    WallTop = 1 << 2,
+    WallBottom = 1 << 3
+};
+
+struct WallBounds
+{
+    float left, right, top, bottom;
+};
+
+SimdTier detectSimdTier();
+bool isSimdTierSupported(SimdTier tier);
+const char *getSimdTierName(SimdTier tier);
+
+// Advance n bullets by dt and write the walls each one is past into wallMask[i]
+void integrateBullets(SimdTier tier, float *x, float *y, const float *vx, const float *vy, size_t n,
+                      float dt, const WallBounds &bounds, unsigned char *wallMask);
+
+inline void integrateBullets(SimdTier tier, BulletPool &pool, float dt, const WallBounds &bounds, unsigned char *wallMask)
+{
+    integrateBullets(tier, pool.x.data(), pool.y.data(), pool.vx.data(), pool.vy.data(), pool.size(), dt, bounds, wallMask);
+}
+
+// Wall index to report for a mask, checked left, right, top, bottom like the old branches
+inline int getFirstWall(unsigned char mask)
+{
+    for (int wall = 0; wall < 4; wall++)
+        if (mask & (1 << wall))
+            return wall;
+    return -1;
+}
@@ -0,0 +1,56 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <cstddef>
+#include "BulletSink.hpp"
+#include "BatchRenderer.hpp"
+
+enum class BulletOwner : unsigned char
+{
+    Player,
+    Enemy
+};
+
+// Fixed-capacity bullet storage laid out as parallel arrays.
+// Only the first size() entries of each array are live; removal swaps the
+// last bullet into the hole so it never shifts the tail.
+class BulletPool : public BulletSink
+{
+private:
+    size_t count = 0;
+    size_t capacity;
+
+    // Owner recorded for bullets arriving through emit()
+    BulletOwner sinkOwner;
+
+public:
+    std::vector<float> x, y;
+    std::vector<float> prevX, prevY;
+    std::vector<float> vx, vy;
+    std::vector<float> radius;
+    std::vector<int> damage;
+    std::vector<BulletOwner> owner;
+
+    BulletPool(size_t capacity, BulletOwner sinkOwner);
+
+    // Returns false and drops the bullet when the pool is full
+    bool spawn(sf::Vector2f pos, sf::Vector2f vel, float r, int dmg, BulletOwner who);
+
+    void emit(sf::Vector2f pos, sf::Vector2f vel, float r, int dmg) override;
+
+    // O(1) removal, the last bullet takes the removed slot
+    void remove(size_t index);
+    void clear();
+
+    // Snapshot positions before the simulation advances
+    void savePreviousState();
+
+    size_t size() const { return count; }
+    size_t getCapacity() const { return capacity; }
+    bool empty() const { return count == 0; }
+
+    sf::Vector2f getPosition(size_t index) const { return sf::Vector2f(x[index], y[index]); }
+    sf::Vector2f getPreviousPosition(size_t index) const { return sf::Vector2f(prevX[index], prevY[index]); }
+
+    void draw(BatchRenderer &batch, float alpha = 1.0f) const;
+};
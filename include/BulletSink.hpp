@@ -0,0 +1,14 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+
+// Destination for newly fired bullets. Shooters write into it directly
+// instead of returning a vector of bullets on every update.
+class BulletSink
+{
+public:
+    // Radius every shooter currently fires with
+    static constexpr float bulletRadius = 8.0f;
+
+    virtual ~BulletSink() = default;
+    virtual void emit(sf::Vector2f pos, sf::Vector2f vel, float radius, int damage) = 0;
+};
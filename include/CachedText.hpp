@@ -0,0 +1,35 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <string>
+#include <string_view>
+
+// sf::Text that keeps its glyph layout between frames. The string is only
+// replaced, and the origin only recomputed, when the content really changes.
+class CachedText
+{
+private:
+    sf::Text text;
+    std::string content;
+    bool centered;
+
+    // Value shown by setNumber(), compared before any formatting happens
+    int number = 0;
+    bool hasNumber = false;
+
+    void relayout();
+
+public:
+    CachedText(const sf::Font &font, const std::string &str, unsigned int size, sf::Color color, bool centered = true);
+
+    void setString(std::string_view str);
+
+    // Show prefix + value + suffix, formatting only when value changed. The
+    // text is built in place in content; sf::Text still allocates its own
+    // copy, so a frame where the value changes goes over the allocation budget.
+    void setNumber(const char *prefix, int value, const char *suffix = "");
+
+    // Moving the text never re-lays it out
+    void setPosition(sf::Vector2f pos) { text.setPosition(pos); }
+
+    void draw(sf::RenderTarget &target) const { target.draw(text); }
+};
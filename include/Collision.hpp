@@ -0,0 +1,79 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cmath>
+#include "BulletKernels.hpp"
+
+// Continuous collision tests. Each body moves in a straight line from its
+// position at the start of the tick (t = 0) to its position now (t = 1), so a
+// fast bullet is caught even if it skipped over the target between two ticks.
+namespace Collision
+{
+    // Returned when the bodies never touch during the tick
+    constexpr float noHit = 2.0f;
+
+    // First time in [0, 1] at which circle A (a0 -> a1, radius ra) touches
+    // circle B (b0 -> b1, radius rb), 0 if they already overlap at the start
+    inline float sweptCircles(sf::Vector2f a0, sf::Vector2f a1, float ra, sf::Vector2f b0, sf::Vector2f b1, float rb)
+    {
+        // Work in B's frame: A starts at d and moves by v
+        sf::Vector2f d = a0 - b0;
+        sf::Vector2f v = (a1 - a0) - (b1 - b0);
+        float reach = ra + rb;
+
+        float c = d.x * d.x + d.y * d.y - reach * reach;
+        if (c <= 0.0f)
+            return 0.0f;
+
+        float a = v.x * v.x + v.y * v.y;
+        float b = d.x * v.x + d.y * v.y;
+        if (a <= 0.0f || b >= 0.0f)
+            return noHit; // Not moving, or moving apart
+
+        float disc = b * b - a * c;
+        if (disc < 0.0f)
+            return noHit;
+
+        float t = (-b - std::sqrt(disc)) / a;
+        return t <= 1.0f ? t : noHit;
+    }
+
+    // Centre and radius of a circle enclosing a whole sweep, for broadphase queries
+    inline float sweptRadius(sf::Vector2f p0, sf::Vector2f p1, float radius, sf::Vector2f &centre)
+    {
+        centre = (p0 + p1) * 0.5f;
+        sf::Vector2f half = (p1 - p0) * 0.5f;
+        return radius + std::sqrt(half.x * half.x + half.y * half.y);
+    }
+
+    struct WallHit
+    {
+        float time = noHit;
+        int wall = -1; // Index as in PlayingWindow::hitWall
+    };
+
+    // When the point p0 -> p1 first passes one of the walls in mask while the
+    // walls themselves move from `from` to `to`
+    inline WallHit sweptWalls(sf::Vector2f p0, sf::Vector2f p1, unsigned char mask, const WallBounds &from, const WallBounds &to)
+    {
+        // Signed distance inside each wall at the start and end of the tick,
+        // in the same order as the wall bits
+        const float start[4] = {p0.x - from.left, from.right - p0.x, p0.y - from.top, from.bottom - p0.y};
+        const float end[4] = {p1.x - to.left, to.right - p1.x, p1.y - to.top, to.bottom - p1.y};
+
+        WallHit hit;
+        for (int wall = 0; wall < 4; wall++)
+        {
+            if (!(mask & (1 << wall)))
+                continue;
+
+            // Distance changes linearly, so it reaches zero once
+            float t = start[wall] <= 0.0f ? 0.0f : start[wall] / (start[wall] - end[wall]);
+            if (t < hit.time)
+            {
+                hit.time = t;
+                hit.wall = wall;
+            }
+        }
+        return hit;
+    }
+}
@@ -1,7 +1,8 @@
 #pragma once
 #include <SFML/Graphics.hpp>
 #include "Entity.hpp"
-#include "Bullet.hpp"
+#include "BulletSink.hpp"
+#include "FlowField.hpp"
 #include <vector>
 #include <memory>
 
@@ -12,8 +13,15 @@ public:
     Enemy(sf::Vector2f position, float speedVal, int hp, int currency);
     virtual ~Enemy() = default;
 
-    // Pure virtual update to enforce specific behavior
-    virtual std::vector<Bullet> update(sf::Vector2f playerPos, float dt) = 0;
+    // Pure virtual update to enforce specific behavior, steering comes from the
+    // shared flow field plus the push away from overlapping enemies, and shots
+    // go straight into out
+    virtual void update(const FlowField &flow, sf::Vector2f separation, float dt, BulletSink &out) = 0;
+
+    // Seconds until the first wake after spawning, negative for none. Types
+    // with a timer have a wake(flow) that EnemyStore calls when it runs out,
+    // returning the seconds until the next wake or a negative value for none.
+    float getFirstTimer() const { return firstTimer; }
 
     void takeDamage(int damage);
     bool isDead() const;
@@ -25,45 +33,59 @@ protected:
     int maxHealth;
     int currencyDrop;
     
-    // Shooting logic helper
-    float reloadTimer = 0.0f;
+    float firstTimer = -1.0f;
+
+    // Shooting logic helper, the timer wheel reloads
+    bool readyToFire = true;
     float reloadTime = 2.0f;
+
+    // Move out of the enemies this one overlaps, see Separation
+    void applySeparation(sf::Vector2f separation, float dt);
 };
 
 // --- Derived Classes ---
+// contactDamage is dealt to the player each step the bodies overlap
 
-class Triangle : public Enemy
+class Triangle final : public Enemy
 {
 public:
+    static constexpr int contactDamage = 20;
+
     Triangle(sf::Vector2f position);
-    std::vector<Bullet> update(sf::Vector2f playerPos, float dt) override;
+    void update(const FlowField &flow, sf::Vector2f separation, float dt, BulletSink &out) override;
 };
 
-class Circle : public Enemy
+class Circle final : public Enemy
 {
 public:
+    static constexpr int contactDamage = 20;
+
     Circle(sf::Vector2f position);
-    std::vector<Bullet> update(sf::Vector2f playerPos, float dt) override;
+    void update(const FlowField &flow, sf::Vector2f separation, float dt, BulletSink &out) override;
+    float wake(const FlowField &flow);
 private:
-    float moveTimer = 0.0f;
-    float stopTimer = 0.0f;
     bool isMoving = true;
 };
 
-class Square : public Enemy
+class Square final : public Enemy
 {
 public:
+    static constexpr int contactDamage = 20;
+
     Square(sf::Vector2f position);
-    std::vector<Bullet> update(sf::Vector2f playerPos, float dt) override;
+    void update(const FlowField &flow, sf::Vector2f separation, float dt, BulletSink &out) override;
+    float wake(const FlowField &flow);
 private:
-    float moveTimer = 0.0f;
     bool isMoving = false;
     sf::Vector2f dashDirection;
 };
 
-class Spiker : public Enemy
+class Spiker final : public Enemy
 {
 public:
+    static constexpr int contactDamage = 120;
+
     Spiker(sf::Vector2f position);
-    std::vector<Bullet> update(sf::Vector2f playerPos, float dt) override;
+    void update(const FlowField &flow, sf::Vector2f separation, float dt, BulletSink &out) override;
+    float wake(const FlowField &flow);
 };
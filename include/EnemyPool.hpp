@@ -0,0 +1,187 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Enemy.hpp"
+
+enum class EnemyType : unsigned char
+{
+    Triangle,
+    Circle,
+    Square,
+    Spiker
+};
+
+template <typename T>
+constexpr EnemyType enemyTypeOf();
+template <> constexpr EnemyType enemyTypeOf<Triangle>() { return EnemyType::Triangle; }
+template <> constexpr EnemyType enemyTypeOf<Circle>() { return EnemyType::Circle; }
+template <> constexpr EnemyType enemyTypeOf<Square>() { return EnemyType::Square; }
+template <> constexpr EnemyType enemyTypeOf<Spiker>() { return EnemyType::Spiker; }
+
+// Weak reference to an enemy. It stops resolving once the enemy is removed,
+// even if a new enemy later reuses the same slot.
+struct EnemyHandle
+{
+    uint32_t slot = 0;
+    uint32_t generation = 0; // 0 never matches a live enemy
+    EnemyType type = EnemyType::Triangle;
+
+    bool operator==(const EnemyHandle &other) const
+    {
+        return slot == other.slot && generation == other.generation && type == other.type;
+    }
+    bool operator!=(const EnemyHandle &other) const { return !(*this == other); }
+};
+
+struct EnemyPoolStats
+{
+    size_t live = 0;
+    size_t capacity = 0;
+    size_t highWater = 0; // Most enemies alive at once
+    uint64_t spawned = 0;
+    uint64_t removed = 0;
+    uint64_t rejected = 0; // Spawns dropped because the pool was full
+};
+
+// Fixed-capacity storage for one enemy type. Enemies are packed at the front
+// so update loops stay linear; a slot table maps handles to the packed index.
+// Free slots form an intrusive list threaded through the same table, so
+// spawning and removing never touch the heap.
+template <typename T>
+class EnemyPool
+{
+private:
+    struct Slot
+    {
+        uint32_t index;      // Packed index while live, next free slot while free
+        uint32_t generation; // Bumped on every removal
+    };
+
+    static constexpr uint32_t endOfList = ~0u;
+
+    std::vector<T> items;
+    std::vector<uint32_t> owners; // Slot of each packed enemy
+    std::vector<Slot> slots;
+    uint32_t freeHead = endOfList;
+    uint32_t firstGeneration = 1; // Above every generation handed out so far
+    EnemyPoolStats stats;
+
+    void release(size_t index)
+    {
+        Slot &slot = slots[owners[index]];
+        if (++slot.generation == 0)
+            slot.generation = 1;
+        slot.index = freeHead;
+        freeHead = owners[index];
+    }
+
+public:
+    explicit EnemyPool(size_t capacity) { setCapacity(capacity); }
+
+    // Drops every enemy and invalidates all handles
+    void setCapacity(size_t capacity)
+    {
+        items.clear();
+        owners.clear();
+        items.reserve(capacity);
+        owners.reserve(capacity);
+        // Fresh slots start past every old generation, so no handle from
+        // before the resize can match an enemy spawned after it
+        for (const Slot &slot : slots)
+            if (slot.generation >= firstGeneration)
+                firstGeneration = slot.generation + 1;
+        if (firstGeneration == 0)
+            firstGeneration = 1;
+        slots.assign(capacity, Slot{endOfList, firstGeneration});
+        freeHead = endOfList;
+        for (size_t i = capacity; i-- > 0;)
+        {
+            slots[i].index = freeHead;
+            freeHead = static_cast<uint32_t>(i);
+        }
+        stats = EnemyPoolStats();
+        stats.capacity = capacity;
+    }
+
+    // Returns an invalid handle and drops the enemy when the pool is full
+    EnemyHandle spawn(sf::Vector2f pos)
+    {
+        if (freeHead == endOfList)
+        {
+            stats.rejected++;
+            return EnemyHandle();
+        }
+
+        uint32_t slot = freeHead;
+        freeHead = slots[slot].index;
+        slots[slot].index = static_cast<uint32_t>(items.size());
+        items.emplace_back(pos);
+        owners.push_back(slot);
+
+        stats.spawned++;
+        if (items.size() > stats.highWater)
+            stats.highWater = items.size();
+        return EnemyHandle{slot, slots[slot].generation, enemyTypeOf<T>()};
+    }
+
+    // O(1) removal, the last enemy takes the packed index
+    void remove(size_t index)
+    {
+        release(index);
+        size_t last = items.size() - 1;
+        if (index != last)
+        {
+            items[index] = std::move(items[last]);
+            owners[index] = owners[last];
+            slots[owners[index]].index = static_cast<uint32_t>(index);
+        }
+        items.pop_back();
+        owners.pop_back();
+        stats.removed++;
+    }
+
+    void clear()
+    {
+        for (size_t i = items.size(); i-- > 0;)
+            release(i);
+        stats.removed += items.size();
+        items.clear();
+        owners.clear();
+    }
+
+    // Null once the enemy has been removed
+    T *get(EnemyHandle handle)
+    {
+        if (handle.type != enemyTypeOf<T>() || handle.slot >= slots.size() || slots[handle.slot].generation != handle.generation)
+            return nullptr;
+        return &items[slots[handle.slot].index];
+    }
+
+    const T *get(EnemyHandle handle) const { return const_cast<EnemyPool *>(this)->get(handle); }
+
+    EnemyHandle getHandle(size_t index) const
+    {
+        return EnemyHandle{owners[index], slots[owners[index]].generation, enemyTypeOf<T>()};
+    }
+
+    EnemyPoolStats getStats() const
+    {
+        EnemyPoolStats s = stats;
+        s.live = items.size();
+        return s;
+    }
+
+    size_t size() const { return items.size(); }
+    size_t getCapacity() const { return slots.size(); }
+    bool empty() const { return items.empty(); }
+
+    T &operator[](size_t index) { return items[index]; }
+    const T &operator[](size_t index) const { return items[index]; }
+
+    T *begin() { return items.data(); }
+    T *end() { return items.data() + items.size(); }
+    const T *begin() const { return items.data(); }
+    const T *end() const { return items.data() + items.size(); }
+};
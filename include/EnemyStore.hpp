@@ -0,0 +1,231 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cmath>
+#include <type_traits>
+#include "Enemy.hpp"
+#include "EnemyPool.hpp"
+#include "TimerWheel.hpp"
+
+// Enemies grouped by concrete type, each type stored contiguously by value.
+// Per-type loops call the final update overrides directly, and type tests
+// become compile-time choices instead of dynamic_casts.
+class EnemyStore
+{
+public:
+    // Per type, enough for a long session with room to spare
+    static constexpr size_t defaultCapacity = 2048;
+
+private:
+    EnemyPool<Triangle> triangles;
+    EnemyPool<Circle> circles;
+    EnemyPool<Square> squares;
+    EnemyPool<Spiker> spikers;
+    size_t highWater = 0;
+
+    // Behaviour timers of every enemy. Removed enemies leave their timer
+    // behind, it is dropped when it fires and the handle no longer resolves.
+    TimerWheel<EnemyHandle> timers;
+    std::vector<EnemyHandle> dueTimers[4]; // Per EnemyType
+    float ticksPerSecond = 60.0f;
+
+    void schedule(EnemyHandle handle, float seconds)
+    {
+        timers.schedule(handle, static_cast<uint32_t>(std::lround(seconds * ticksPerSecond)));
+    }
+
+    void reserveDueTimers(size_t capacityPerType)
+    {
+        for (std::vector<EnemyHandle> &due : dueTimers)
+            due.reserve(capacityPerType * 4);
+    }
+
+    // Wakes the enemies of one type whose timer fired this tick, calling the
+    // type's own wake() without going through Enemy
+    template <typename T>
+    void wakeGroup(const FlowField &flow)
+    {
+        EnemyPool<T> &group = getGroup<T>();
+        for (EnemyHandle handle : dueTimers[static_cast<size_t>(enemyTypeOf<T>())])
+        {
+            T *enemy = group.get(handle);
+            if (!enemy)
+                continue;
+            float next = enemy->wake(flow);
+            if (next >= 0.0f)
+                schedule(handle, next);
+        }
+    }
+
+public:
+    explicit EnemyStore(size_t capacityPerType = defaultCapacity)
+        : triangles(capacityPerType), circles(capacityPerType), squares(capacityPerType), spikers(capacityPerType),
+          timers(capacityPerType * 4)
+    {
+        reserveDueTimers(capacityPerType);
+    }
+
+    // Drops every enemy and invalidates all handles
+    void setCapacity(size_t capacityPerType)
+    {
+        forEachGroup([&](auto &group) { group.setCapacity(capacityPerType); });
+        timers.clear();
+        timers.reserve(capacityPerType * 4);
+        reserveDueTimers(capacityPerType);
+        highWater = 0;
+    }
+
+    // Timer lengths are given in seconds and counted in ticks
+    void setTickRate(float rate) { ticksPerSecond = rate; }
+
+    // Advance the timers by one tick and wake the enemies whose timer ran out,
+    // gathered per type first and woken one type at a time. Enemies without a
+    // timer due are not touched at all, and Triangles never set one.
+    void updateTimers(const FlowField &flow)
+    {
+        for (std::vector<EnemyHandle> &due : dueTimers)
+            due.clear();
+        timers.advance([&](EnemyHandle handle) { dueTimers[static_cast<size_t>(handle.type)].push_back(handle); });
+        wakeGroup<Circle>(flow);
+        wakeGroup<Square>(flow);
+        wakeGroup<Spiker>(flow);
+    }
+
+    size_t getPendingTimers() const { return timers.size(); }
+
+    template <typename T>
+    EnemyPool<T> &getGroup()
+    {
+        if constexpr (std::is_same_v<T, Triangle>) return triangles;
+        else if constexpr (std::is_same_v<T, Circle>) return circles;
+        else if constexpr (std::is_same_v<T, Square>) return squares;
+        else
+        {
+            static_assert(std::is_same_v<T, Spiker>, "Unknown enemy type");
+            return spikers;
+        }
+    }
+
+    template <typename T>
+    const EnemyPool<T> &getGroup() const
+    {
+        return const_cast<EnemyStore *>(this)->getGroup<T>();
+    }
+
+    // Invalid handle if that type's pool is full
+    template <typename T>
+    EnemyHandle spawn(sf::Vector2f pos)
+    {
+        EnemyPool<T> &group = getGroup<T>();
+        EnemyHandle handle = group.spawn(pos);
+        if (handle.generation == 0)
+            return handle;
+
+        if (size() > highWater)
+            highWater = size();
+        float first = group[group.size() - 1].getFirstTimer();
+        if (first >= 0.0f)
+            schedule(handle, first);
+        return handle;
+    }
+
+    // O(1) removal, the last enemy of the same type takes the slot
+    template <typename T>
+    void remove(size_t index)
+    {
+        getGroup<T>().remove(index);
+    }
+
+    // Null once the enemy has been removed
+    Enemy *get(EnemyHandle handle)
+    {
+        switch (handle.type)
+        {
+        case EnemyType::Triangle: return triangles.get(handle);
+        case EnemyType::Circle: return circles.get(handle);
+        case EnemyType::Square: return squares.get(handle);
+        case EnemyType::Spiker: return spikers.get(handle);
+        }
+        return nullptr;
+    }
+
+    const Enemy *get(EnemyHandle handle) const { return const_cast<EnemyStore *>(this)->get(handle); }
+
+    bool isAlive(EnemyHandle handle) const { return get(handle) != nullptr; }
+
+    template <typename T>
+    EnemyHandle getHandle(size_t index) const { return getGroup<T>().getHandle(index); }
+
+    template <typename T>
+    EnemyPoolStats getStats() const { return getGroup<T>().getStats(); }
+
+    // Counters summed over every type, highWater is the most enemies alive at once
+    EnemyPoolStats getStats() const
+    {
+        EnemyPoolStats total;
+        forEachGroup([&](const auto &group)
+        {
+            EnemyPoolStats s = group.getStats();
+            total.live += s.live;
+            total.capacity += s.capacity;
+            total.spawned += s.spawned;
+            total.removed += s.removed;
+            total.rejected += s.rejected;
+        });
+        total.highWater = highWater;
+        return total;
+    }
+
+    template <typename T>
+    size_t count() const { return getGroup<T>().size(); }
+
+    size_t size() const { return triangles.size() + circles.size() + squares.size() + spikers.size(); }
+
+    void clear()
+    {
+        triangles.clear();
+        circles.clear();
+        squares.clear();
+        spikers.clear();
+        timers.clear();
+    }
+
+    // Calls visit(EnemyPool<T> &) once per enemy type
+    template <typename Visitor>
+    void forEachGroup(Visitor &&visit)
+    {
+        visit(triangles);
+        visit(circles);
+        visit(squares);
+        visit(spikers);
+    }
+
+    template <typename Visitor>
+    void forEachGroup(Visitor &&visit) const
+    {
+        visit(triangles);
+        visit(circles);
+        visit(squares);
+        visit(spikers);
+    }
+
+    // Calls visit(Enemy &) for every live enemy
+    template <typename Visitor>
+    void forEach(Visitor &&visit)
+    {
+        forEachGroup([&](auto &group)
+        {
+            for (Enemy &e : group)
+                visit(e);
+        });
+    }
+
+    template <typename Visitor>
+    void forEach(Visitor &&visit) const
+    {
+        forEachGroup([&](const auto &group)
+        {
+            for (const Enemy &e : group)
+                visit(e);
+        });
+    }
+};
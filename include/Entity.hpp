@@ -2,6 +2,7 @@
 #include <SFML/Graphics.hpp>
 #include <vector>
 #include <cmath>
+#include "BatchRenderer.hpp"
 
 struct Barrel
 {
@@ -19,6 +20,11 @@ class Entity
 protected:
     sf::Vector2f position;
     sf::Vector2f velocity;
+
+    // State at the start of the current tick, used to interpolate rendering
+    sf::Vector2f previousPosition;
+    float previousRotation;
+
     float radius;
     float rotation; // In degrees
     sf::Color bodyColor;
@@ -31,10 +37,18 @@ public:
     virtual ~Entity() = default;
 
     virtual void update(float dt);
-    virtual void draw(sf::RenderWindow &window);
+    // Snapshot position and rotation before the simulation advances
+    void savePreviousState();
+
+    // Append barrels and body to the batch, alpha blends from the previous to the current tick
+    virtual void draw(BatchRenderer &batch, float alpha = 1.0f) const;
 
     sf::Vector2f getPosition() const;
     void setPosition(sf::Vector2f pos);
+    // Position at the start of the current tick
+    sf::Vector2f getPreviousPosition() const { return previousPosition; }
+
+    sf::Vector2f getVelocity() const;
     
     float getRadius() const;
     void setRadius(float r);
@@ -45,6 +59,7 @@ public:
 
     void setColor(sf::Color col);
 
+    const std::vector<Barrel> &getBarrels() const { return barrels; }
     void addBarrel(float len, float wid, float off = 0.0f, float ang = 0.0f);
     void clearBarrels();
     
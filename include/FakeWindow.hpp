@@ -1,6 +1,8 @@
 #pragma once
 #include <SFML/Graphics.hpp>
 #include <cmath>
+#include <optional>
+#include <string>
 
 // Base class for different window types
 class FakeWindow
@@ -23,6 +25,18 @@ protected:
     sf::FloatRect animStartRect;
     sf::FloatRect animTargetRect;
 
+    // Frame shapes live across frames and are only moved and resized, so
+    // drawing a window never builds shapes or text
+    sf::RectangleShape titleBarShape;
+    sf::RectangleShape areaShape;
+    sf::RectangleShape borderShape;
+    sf::CircleShape buttonShapes[3];
+    std::optional<sf::Text> titleText; // Created on the first draw, when the font is known
+    std::string shownTitle;            // Only re-laid out when the title changes
+
+    // Title bar, controls, background and border around area
+    void drawFrame(sf::RenderWindow &window, const sf::Font &font, sf::FloatRect area, const char *title, sf::Color background);
+
 public:
     // Initialize window centered on screen
     FakeWindow(int sw, int sh, float initialSize);
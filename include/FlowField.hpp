@@ -0,0 +1,81 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include "BulletKernels.hpp"
+
+// Steering toward the player shared by every enemy. The screen is split into
+// cells and each cell stores the heading, rotation and path length from its
+// centre, so an enemy steers with one lookup instead of its own sqrt and
+// atan2. Cells outside the play area lead to the nearest point inside it
+// first, enemies no longer cut across the window edge. Every cell depends on
+// the player's cell, so the field is rebuilt whole when the player changes
+// cell. A wall crossing a cell boundary only changes the cells that enter the
+// play area through it, so only those are recomputed. Both only happen once enough
+// enemies sample the field to pay for it. With fewer, each sample works out
+// its own cell, which gives the same result.
+class FlowField
+{
+public:
+    // Enemies this close to the player always get the exact direction and
+    // distance, never their cell's. Covers Triangle's slow-down ring.
+    static constexpr float exactRange = 150.0f;
+
+    struct Sample
+    {
+        sf::Vector2f direction; // Unit length, zero on top of the player
+        float distance;         // Length of the path to the player
+        float angle;            // Degrees, for setRotation
+    };
+
+private:
+    float cellSize;
+    float invCellSize;
+    // Cells within this many cells of the player steer at its exact position
+    int nearCells;
+    int columns, rows;
+
+    struct Cell
+    {
+        float dirX, dirY;
+        float distance;
+        float angle;
+    };
+    std::vector<Cell> cells;
+    std::vector<char> columnMoved; // Scratch for refreshOutside()
+
+    // Exact target, enemies this close steer at it directly
+    sf::Vector2f target;
+    int targetCellX = -1, targetCellY = -1;
+    int boundsCells[4] = {-1, -1, -1, -1};
+    bool cellsValid = false;
+    size_t rebuildCount = 0;
+    size_t updatedCells = 0;
+
+    // Where cells head, derived from the target cell and the walls
+    sf::Vector2f goal;
+    float entryLeft = 0.0f, entryRight = 0.0f, entryTop = 0.0f, entryBottom = 0.0f;
+
+    int cellX(float x) const;
+    int cellY(float y) const;
+    Cell computeCell(int x, int y) const;
+    void rebuild();
+    // Recompute the cells whose way into the play area changed with the walls
+    void refreshOutside(float oldLeft, float oldRight, float oldTop, float oldBottom);
+
+public:
+    // Covers [0, worldSize], anything outside samples the border cells
+    FlowField(sf::Vector2f worldSize, float cellSize = 64.0f);
+
+    // Point the field at the player, walls are the current play area.
+    // samplers is how many enemies will sample the field before the next
+    // update; below half the number of cells a rebuild costs more than it saves.
+    void update(sf::Vector2f playerPos, const WallBounds &walls, size_t samplers);
+
+    Sample sample(sf::Vector2f pos) const;
+
+    sf::Vector2f getTarget() const { return target; }
+    // Times all cells were recomputed, and cells recomputed in total counting
+    // wall moves, for profiling the incremental updates
+    size_t getRebuildCount() const { return rebuildCount; }
+    size_t getUpdatedCellCount() const { return updatedCells; }
+};
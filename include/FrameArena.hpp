@@ -0,0 +1,58 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+
+// Bump allocator for data that only lives until the end of the frame. One
+// buffer is allocated up front and reset() hands all of it back at once;
+// deallocate() is a no-op. Requests that no longer fit go to the upstream
+// resource and are counted, so the buffer can be sized from the reported peak.
+// Not thread-safe, each thread that needs scratch memory owns its own arena.
+class FrameArena : public std::pmr::memory_resource
+{
+private:
+    // Header of a block taken from upstream after the buffer ran out
+    struct Overflow
+    {
+        Overflow *next;
+        void *block;
+        size_t bytes;
+        size_t alignment;
+    };
+
+    std::unique_ptr<std::byte[]> buffer;
+    size_t capacity;
+    size_t used = 0; // Offset into buffer
+    size_t overflowBytes = 0;
+    size_t peak = 0;
+    size_t overflowCount = 0;
+    Overflow *overflow = nullptr;
+    std::pmr::memory_resource *upstream;
+
+protected:
+    void *do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void *, size_t, size_t) override {}
+    bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override { return this == &other; }
+
+public:
+    explicit FrameArena(size_t capacity, std::pmr::memory_resource *upstream = std::pmr::new_delete_resource());
+    ~FrameArena();
+
+    FrameArena(const FrameArena &) = delete;
+    FrameArena &operator=(const FrameArena &) = delete;
+
+    // Frees everything handed out since the last reset
+    void reset();
+
+    size_t getUsed() const { return used + overflowBytes; }
+    size_t getCapacity() const { return capacity; }
+    // Most bytes used in a single frame, overflow included
+    size_t getPeak() const { return peak; }
+    // Allocations that did not fit in the buffer since construction
+    size_t getOverflowCount() const { return overflowCount; }
+};
+
+// Containers that draw from a frame arena
+template <typename T>
+using FrameVector = std::pmr::vector<T>;
+using FrameString = std::pmr::string;
@@ -0,0 +1,30 @@
+#pragma once
+#include <SFML/System.hpp>
+#include <cstdint>
+
+// Player input sampled for a single simulation step
+struct InputFrame
+{
+    bool moveUp = false;
+    bool moveDown = false;
+    bool moveLeft = false;
+    bool moveRight = false;
+    bool fire = false;
+
+    // Aim target in world coordinates
+    sf::Vector2f aimPos;
+};
+
+// One-off actions taken from the upgrade window while the game is paused
+enum class CommandType : unsigned char
+{
+    UpgradeStat, // value is the stat index
+    SelectTank   // value is the index into the current tank's upgrade list
+};
+
+struct Command
+{
+    uint32_t tick = 0; // Applied before this tick runs
+    CommandType type = CommandType::UpgradeStat;
+    int value = 0;
+};
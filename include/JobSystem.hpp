@@ -0,0 +1,102 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fixed set of worker threads that run loop chunks. Every thread, the caller
+// included, has its own queue and steals from the others once it runs dry.
+// A job may call parallelFor() again, the waiting thread keeps running jobs.
+class JobSystem
+{
+public:
+    using ChunkFn = void (*)(void *context, size_t chunk);
+
+private:
+    struct Job
+    {
+        ChunkFn fn;
+        void *context;
+        size_t chunk;
+        std::atomic<size_t> *pending;
+    };
+
+    // Ring buffer guarded by a mutex. The owner takes from the back, thieves
+    // from the front, so stolen work tends to be the largest untouched range.
+    struct WorkQueue
+    {
+        static const size_t capacity = 1024;
+        std::mutex mutex;
+        Job jobs[capacity];
+        size_t head = 0;
+        size_t count = 0;
+
+        bool push(const Job &job);
+        bool popBack(Job &job);
+        bool popFront(Job &job);
+    };
+
+    std::vector<std::thread> workers;
+    // One queue per worker, the last one belongs to the calling thread
+    std::unique_ptr<WorkQueue[]> queues;
+    size_t queueCount;
+
+    std::mutex sleepMutex;
+    std::condition_variable wake;
+    std::atomic<size_t> queuedJobs{0};
+    bool stopping = false;
+
+    bool tryRunJob(size_t self);
+    size_t getOwnQueue() const;
+    void workerLoop(size_t index);
+    void run(ChunkFn fn, void *context, size_t chunks);
+
+public:
+    // 0 workers runs everything on the calling thread
+    explicit JobSystem(unsigned workerThreads = getDefaultWorkerCount());
+    ~JobSystem();
+
+    JobSystem(const JobSystem &) = delete;
+    JobSystem &operator=(const JobSystem &) = delete;
+
+    // One worker per core besides the calling thread
+    static unsigned getDefaultWorkerCount();
+    size_t getWorkerCount() const { return workers.size(); }
+
+    // Run one queued job on this thread if there is one, for callers that
+    // would otherwise spin while they wait
+    bool runPendingJob() { return tryRunJob(getOwnQueue()); }
+
+    // Calls fn(chunk, begin, end) for consecutive ranges of at most grain items
+    // and returns once all of them finished. Chunk numbers follow index order,
+    // so per-chunk output can be merged deterministically.
+    template <typename F>
+    void parallelFor(size_t count, size_t grain, F &&fn)
+    {
+        grain = std::max<size_t>(grain, 1);
+        size_t chunks = (count + grain - 1) / grain;
+        if (chunks <= 1 || workers.empty())
+        {
+            for (size_t chunk = 0; chunk < chunks; chunk++)
+                fn(chunk, chunk * grain, std::min(count, (chunk + 1) * grain));
+            return;
+        }
+
+        struct Context
+        {
+            F *fn;
+            size_t count;
+            size_t grain;
+        } context{&fn, count, grain};
+
+        run([](void *data, size_t chunk)
+        {
+            Context &c = *static_cast<Context *>(data);
+            (*c.fn)(chunk, chunk * c.grain, std::min(c.count, (chunk + 1) * c.grain));
+        }, &context, chunks);
+    }
+};
@@ -2,12 +2,11 @@
 #include <SFML/Graphics.hpp>
 #include "Entity.hpp"
 #include "FakeWindow.hpp"
-#include "Bullet.hpp"
+#include "BulletSink.hpp"
 #include "TankClass.hpp"
+#include "InputFrame.hpp"
 #include <memory>
 
-class Tank;
-
 // The player character controlled by the user
 class Player : public Entity
 {
@@ -18,8 +17,8 @@ public:
     int currency = 0; // will use this after
     
     // Current Tank Class
-    std::shared_ptr<Tank> currentTank;
-    void setTank(std::shared_ptr<Tank> newTank);
+    Tank currentTank;
+    void setTank(Tank newTank);
     
     // Leveling System
     int xp = 0;
@@ -54,8 +53,8 @@ public:
 
     Player(float radius = 20.0f, float speed = 5.0f, float startX = 0.0f, float startY = 0.0f);
 
-    // Handle keyboard input for movement
-    void handleInput();
+    // Apply movement input for this step
+    void handleInput(const InputFrame &input);
 
     // Keep player inside the window boundaries
     void constrainToWindow(const FakeWindow &fw);
@@ -63,8 +62,8 @@ public:
     // Override update to handle stats regen, reload, etc.
     void update(float dt) override;
 
-    // Create bullets aimed at target position
-    std::vector<Bullet> createBullets(sf::Vector2f targetPos);
+    // Fire one bullet per barrel aimed at target position
+    void createBullets(sf::Vector2f targetPos, BulletSink &out);
 
     void earnXp(int amount);
     void earnCurrency(int amount); 
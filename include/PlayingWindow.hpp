@@ -12,8 +12,8 @@ private:
     const float expandAmount = 20.0f;
     // How fast the window shrinks
     const float collapseSpeed = 0.2f;
-    // How fast the window expands back
-    const float expandSpeed = 15.0f;
+    // How fast the walls move towards their targets, in pixels per second
+    const float expandSpeed = 900.0f;
 
 public:
     PlayingWindow(int sw, int sh, float initialSize);
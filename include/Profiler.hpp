@@ -0,0 +1,69 @@
+#pragma once
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+// Low-overhead frame profiler. Zone timings and counters go into a fixed ring
+// buffer with no locks or allocations, so it can stay on in release builds.
+// Build with -DWINDOWSHOCK_NO_PROFILE to compile the macros out entirely.
+class Profiler
+{
+public:
+    static const int maxZones = 32;
+    static const int maxCounters = 16;
+
+    // Ids are handed out once per call site by the macros below
+    static int registerZone(const char *name);
+    static int registerCounter(const char *name);
+
+    static void record(int zone, uint64_t startNs, uint64_t endNs);
+    static void setCounter(int counter, int64_t value);
+
+    // Closes the current frame: per-zone totals go into the percentile history
+    static void endFrame();
+
+    static void setEnabled(bool enabled);
+    static bool isEnabled();
+
+    static uint64_t now();
+
+    // Chrome trace-event JSON of the most recent records, open in chrome://tracing or Perfetto
+    static bool writeChromeTrace(const std::string &path);
+
+    // p50/p95/p99 of each zone's per-frame time
+    static void printSummary(std::ostream &out);
+};
+
+// Times the enclosing scope
+class ProfileZone
+{
+private:
+    int zone;
+    uint64_t start;
+
+public:
+    explicit ProfileZone(int zone) : zone(zone), start(Profiler::isEnabled() ? Profiler::now() : 0) {}
+    ~ProfileZone()
+    {
+        if (start != 0)
+            Profiler::record(zone, start, Profiler::now());
+    }
+};
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+
+#ifndef WINDOWSHOCK_NO_PROFILE
+#define PROFILE_SCOPE(name)                                                                   \
+    static const int PROFILE_CONCAT(profileZoneId, __LINE__) = Profiler::registerZone(name); \
+    ProfileZone PROFILE_CONCAT(profileZone, __LINE__)(PROFILE_CONCAT(profileZoneId, __LINE__))
+#define PROFILE_COUNTER(name, value)                                                                \
+    do                                                                                              \
+    {                                                                                               \
+        static const int profileCounterId = Profiler::registerCounter(name);                        \
+        Profiler::setCounter(profileCounterId, static_cast<int64_t>(value));                        \
+    } while (0)
+#else
+#define PROFILE_SCOPE(name) ((void)0)
+#define PROFILE_COUNTER(name, value) ((void)0)
+#endif
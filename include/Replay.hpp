@@ -0,0 +1,29 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "InputFrame.hpp"
+
+// Everything needed to rerun a session bit-exactly: the seed and settings it
+// started with, the input of every tick and the upgrade commands in between
+struct Replay
+{
+    uint64_t seed = 0;
+    float tickRate = 60.0f;
+    int screenWidth = 1920;
+    int screenHeight = 1080;
+    float initialSize = 675.0f;
+
+    std::vector<InputFrame> frames;
+    std::vector<Command> commands;
+
+    // Simulation::getChecksum() after the last tick, 0 if not known
+    uint64_t finalChecksum = 0;
+
+    void clear();
+
+    // Binary file, little endian, independent of struct layout
+    bool save(const std::string &path) const;
+    bool load(const std::string &path);
+};
@@ -0,0 +1,45 @@
+#pragma once
+#include <cstdint>
+
+// Small seeded generator (PCG32) so a run depends only on its seed and input.
+// Uses integer math only, so the same seed gives the same sequence on every
+// compiler and platform, unlike rand().
+class Rng
+{
+private:
+    uint64_t state = 0;
+    uint64_t increment = 1;
+
+public:
+    explicit Rng(uint64_t seed = 0x853c49e6748fea9bULL) { reseed(seed); }
+
+    void reseed(uint64_t seed)
+    {
+        state = 0;
+        increment = (seed << 1u) | 1u;
+        next();
+        state += seed;
+        next();
+    }
+
+    uint32_t next()
+    {
+        uint64_t old = state;
+        state = old * 6364136223846793005ULL + increment;
+        uint32_t xorShifted = static_cast<uint32_t>(((old >> 18u) ^ old) >> 27u);
+        uint32_t rot = static_cast<uint32_t>(old >> 59u);
+        return (xorShifted >> rot) | (xorShifted << ((32u - rot) & 31u));
+    }
+
+    // Uniform integer in [0, bound), bound must be positive
+    int nextInt(int bound)
+    {
+        return static_cast<int>((static_cast<uint64_t>(next()) * static_cast<uint32_t>(bound)) >> 32);
+    }
+
+    // Uniform float in [0, 1)
+    float nextFloat()
+    {
+        return static_cast<float>(next() >> 8) * (1.0f / 16777216.0f);
+    }
+};
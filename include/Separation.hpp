@@ -0,0 +1,38 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include "SpatialGrid.hpp"
+
+// Pushes overlapping enemies apart. Bodies are bucketed in a uniform grid so
+// each one only looks at its neighbours, the cost grows with local crowding
+// rather than with the square of the swarm.
+class Separation
+{
+private:
+    SpatialGrid grid;
+    std::vector<sf::Vector2f> positions;
+    std::vector<float> radii;
+    std::vector<sf::Vector2f> pushes;
+    std::vector<char> active;
+
+public:
+    explicit Separation(sf::Vector2f worldSize);
+
+    void clear();
+    // Inactive bodies keep their index but neither push nor get pushed
+    void add(sf::Vector2f pos, float radius, bool isActive = true);
+
+    // Bucket the added bodies, must be called before solve()
+    void build();
+
+    // Compute the push of bodies [begin, end). Only reads the other bodies,
+    // so disjoint ranges can be solved on different threads.
+    void solve(size_t begin, size_t end);
+
+    size_t size() const { return positions.size(); }
+
+    // Sum of the overlaps with each neighbour as a fraction of the combined
+    // radii, pointing away from them. Lighter bodies give way to heavier ones.
+    sf::Vector2f getPush(size_t index) const { return pushes[index]; }
+    const sf::Vector2f *getPushes() const { return pushes.data(); }
+};
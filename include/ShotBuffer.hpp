@@ -0,0 +1,33 @@
+#pragma once
+#include <vector>
+#include "BulletSink.hpp"
+
+// Holds shots fired by one chunk of a parallel update until they can be
+// handed to the real pool in a fixed order
+class ShotBuffer : public BulletSink
+{
+private:
+    struct Shot
+    {
+        sf::Vector2f pos;
+        sf::Vector2f vel;
+        float radius;
+        int damage;
+    };
+
+    std::vector<Shot> shots;
+
+public:
+    void emit(sf::Vector2f pos, sf::Vector2f vel, float radius, int damage) override
+    {
+        shots.push_back({pos, vel, radius, damage});
+    }
+
+    // Forward every shot in firing order and empty the buffer, capacity is kept
+    void flushInto(BulletSink &out)
+    {
+        for (const Shot &s : shots)
+            out.emit(s.pos, s.vel, s.radius, s.damage);
+        shots.clear();
+    }
+};
@@ -0,0 +1,208 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+#include "InputFrame.hpp"
+#include "Replay.hpp"
+#include "Rng.hpp"
+#include "GameStats.hpp"
+#include "PlayingWindow.hpp"
+#include "BulletPool.hpp"
+#include "BulletKernels.hpp"
+#include "Enemy.hpp"
+#include "EnemyStore.hpp"
+#include "JobSystem.hpp"
+#include "TaskGraph.hpp"
+#include "Player.hpp"
+#include "SpatialGrid.hpp"
+#include "Collision.hpp"
+#include "FlowField.hpp"
+#include "Separation.hpp"
+#include "ShotBuffer.hpp"
+
+// Owns all gameplay state and advances it without touching a real window
+class Simulation
+{
+private:
+    float screenW, screenH;
+
+    // Upper bound on live bullets per side, extra shots are dropped
+    static constexpr size_t maxBullets = 4096;
+
+    Player player;
+    BulletPool bullets;
+    BulletPool enemyBullets;
+    EnemyStore enemies;
+    GameStats stats;
+
+    // Broadphase over bullets, rebuilt every step
+    SpatialGrid bulletGrid;
+    SpatialGrid enemyBulletGrid;
+
+    // Shared steering toward the player, refreshed once per step
+    FlowField flowField;
+    // Pushes out of overlapping enemies, in forEachGroup order
+    Separation separation;
+
+    // Enemies well outside the window update every lodInterval ticks in one
+    // coarse step and skip separation and bullet tests, so their cost drops to
+    // a fraction of a visible enemy's. One entry per enemy in forEachGroup order.
+    enum EnemyLod : unsigned char
+    {
+        LodFull,
+        LodCoarse, // Far out, catches up on lodInterval ticks this tick
+        LodSkip    // Far out, waiting for its next coarse step
+    };
+    static constexpr float lodMargin = 200.0f;
+    static constexpr uint32_t lodInterval = 4;
+    bool enemyLodEnabled = true;
+    std::vector<EnemyLod> enemyLod;
+    size_t farEnemies = 0;
+    std::vector<char> bulletSpent;
+    std::vector<char> enemyBulletSpent;
+
+    // Per-bullet wall flags written by the integration kernel, one per side
+    // so both bullet phases can run at once
+    SimdTier simdTier;
+    std::vector<unsigned char> wallMask;
+    std::vector<unsigned char> enemyWallMask;
+
+    // Walls at the start of the tick, collisions sweep from there to now
+    WallBounds previousWalls{};
+    // When and where each player bullet leaves the window, it is only removed
+    // after enemy collisions so an enemy in its path earlier in the tick wins
+    std::vector<Collision::WallHit> bulletWallHits;
+
+    // Enemy AI runs in chunks on the job system, each chunk fires into its
+    // own buffer and the buffers are merged in chunk order
+    static constexpr size_t enemiesPerChunk = 256;
+    std::unique_ptr<JobSystem> jobs;
+    std::vector<ShotBuffer> shotBuffers;
+    size_t shotBuffersUsed = 0;
+
+    // Data each phase touches, the task graph orders phases that share one
+    enum StepData : uint32_t
+    {
+        DataWindowBounds = 1 << 0,  // Current wall positions
+        DataWindowTargets = 1 << 1, // Where the walls are heading
+        DataPlayerMotion = 1 << 2,  // Position, rotation, barrels
+        DataPlayerState = 1 << 3,   // Health, xp, reload
+        DataBullets = 1 << 4,
+        DataEnemyBullets = 1 << 5,
+        DataEnemies = 1 << 6,
+        DataShotBuffers = 1 << 7,
+        DataSpawner = 1 << 8, // Spawn timer and rng
+        DataStats = 1 << 9,
+        DataFlowField = 1 << 10,
+        DataSeparation = 1 << 11,
+        DataEnemyLod = 1 << 12
+    };
+
+    // The phases of step(), built once in the constructor
+    TaskGraph stepGraph;
+    float stepDt = 0.0f;
+    const InputFrame *stepInput = nullptr;
+    void buildStepGraph();
+
+    // Play area, owned here so the simulation never depends on the renderer
+    std::unique_ptr<PlayingWindow> playingWindow;
+
+    // Fixed tick length and the frame time not yet simulated
+    float tickDuration;
+    float accumulator = 0.0f;
+
+    // Longest frame advance() will catch up on, so a stall cannot snowball
+    const float maxFrameTime = 0.25f;
+
+    // Simulated time replaces the real-time clocks used by the old loop
+    float gameTime = 0.0f;
+    float enemySpawnTimer = 0.0f;
+    const float enemySpawnInterval = 2.0f;
+
+    // All randomness comes from here so a run is reproducible from its seed
+    Rng rng;
+    uint64_t seed = 0;
+    float initialSize = 675.0f;
+    uint32_t tickCount = 0;
+
+    // Receives every tick's input and command while recording
+    Replay *recording = nullptr;
+
+    void savePreviousState();
+    WallBounds getWallBounds() const;
+    void updatePlayer(float dt, const InputFrame &input);
+    void updatePlayerBullets(float dt);
+    void updateEnemyBullets(float dt);
+    void spawnEnemies(float dt);
+    static bool isFarFromWindow(sf::Vector2f pos, const WallBounds &walls);
+    void updateEnemyLod();
+    void separateEnemies();
+    void updateEnemyAI(float dt);
+    void mergeEnemyShots();
+    void resolveEnemyCollisions();
+
+    template <typename T>
+    void updateEnemyGroupAI(EnemyPool<T> &group, const sf::Vector2f *pushes, const EnemyLod *lods, float dt);
+    template <typename T>
+    void resolveEnemyGroup(EnemyPool<T> &group);
+
+public:
+    // workerThreads 0 keeps the whole step on the calling thread
+    Simulation(int sw, int sh, float tickRate = 60.0f, unsigned workerThreads = JobSystem::getDefaultWorkerCount());
+
+    // Start a new run with the play area collapsing from the given size
+    void reset(float initialSize, uint64_t runSeed = 0);
+
+    // Skip the opening collapse, playback uses this since no ticks run during it
+    void skipCollapseAnimation();
+
+    // Advance gameplay by dt seconds using the given input
+    void step(float dt, const InputFrame &input);
+
+    // Run as many fixed ticks as fit in frameTime plus the leftover from earlier
+    // frames, returns the number of ticks run
+    int advance(float frameTime, const InputFrame &input);
+
+    void setTickRate(float ticksPerSecond);
+    float getTickRate() const { return 1.0f / tickDuration; }
+    float getTickDuration() const { return tickDuration; }
+
+    // How far rendering sits between the previous and the current tick, 0 to 1
+    float getInterpolationAlpha() const { return accumulator / tickDuration; }
+
+    // Apply an upgrade window action, recorded so replays stay in sync
+    void execute(const Command &command);
+
+    // Capture the run from the current tick into replay until stopRecording()
+    void startRecording(Replay &replay);
+    void stopRecording();
+    bool isRecording() const { return recording != nullptr; }
+
+    // Hash of the gameplay state, equal values mean two runs match bit for bit
+    uint64_t getChecksum() const;
+    uint32_t getTickCount() const { return tickCount; }
+    uint64_t getSeed() const { return seed; }
+
+    bool isPlayerDead() const;
+
+    Player &getPlayer() { return player; }
+    const Player &getPlayer() const { return player; }
+    const BulletPool &getBullets() const { return bullets; }
+    const BulletPool &getEnemyBullets() const { return enemyBullets; }
+    EnemyStore &getEnemies() { return enemies; }
+    const EnemyStore &getEnemies() const { return enemies; }
+    size_t getWorkerCount() const { return jobs->getWorkerCount(); }
+
+    // On by default. Benchmarks switch it off to run every enemy at full rate
+    void setEnemyLodEnabled(bool enabled) { enemyLodEnabled = enabled; }
+    // Enemies on the reduced rate during the last step
+    size_t getFarEnemyCount() const { return farEnemies; }
+
+    // Phases of the last step with their timings, for critical path analysis
+    const TaskGraph &getStepGraph() const { return stepGraph; }
+    const GameStats &getStats() const { return stats; }
+    PlayingWindow &getWindow() { return *playingWindow; }
+    const PlayingWindow &getWindow() const { return *playingWindow; }
+};
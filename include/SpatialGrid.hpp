@@ -0,0 +1,62 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <algorithm>
+
+// Uniform grid broadphase for circle collision queries.
+// Items are bucketed by their centre and rebuilt every step; queries are widened
+// by the largest inserted radius so mixed sizes (bullets, enemies, bosses) still match.
+class SpatialGrid
+{
+private:
+    float cellSize;
+    float invCellSize;
+    int columns, rows;
+
+    // Items sorted by cell, cellStart[c]..cellStart[c + 1] indexes into cellItems
+    std::vector<int> cellStart;
+    std::vector<int> cellItems;
+    std::vector<int> cellCursor;
+
+    // Staging for the current build
+    std::vector<int> itemIds;
+    std::vector<int> itemCells;
+    float maxRadius = 0.0f;
+
+    int cellX(float x) const;
+    int cellY(float y) const;
+
+public:
+    // Covers [0, worldSize], anything outside is clamped into the border cells
+    SpatialGrid(sf::Vector2f worldSize, float cellSize = 64.0f);
+
+    void clear();
+    void insert(int id, sf::Vector2f pos, float radius);
+
+    // Sort inserted items into cells, must be called before querying
+    void build();
+
+    size_t size() const { return itemIds.size(); }
+
+    // Visit every item whose cell could hold a circle overlapping (pos, radius)
+    template <typename Visitor>
+    void query(sf::Vector2f pos, float radius, Visitor &&visit) const
+    {
+        if (itemIds.empty())
+            return;
+
+        float reach = radius + maxRadius;
+        int minX = cellX(pos.x - reach), maxX = cellX(pos.x + reach);
+        int minY = cellY(pos.y - reach), maxY = cellY(pos.y + reach);
+
+        for (int cy = minY; cy <= maxY; cy++)
+        {
+            for (int cx = minX; cx <= maxX; cx++)
+            {
+                int cell = cy * columns + cx;
+                for (int i = cellStart[cell]; i < cellStart[cell + 1]; i++)
+                    visit(cellItems[i]);
+            }
+        }
+    }
+};
@@ -1,161 +1,164 @@
 #pragma once
-#include <vector>
-#include <memory>
-#include <string>
+#include <cstddef>
 
 class Player;
 
-// Abstract Base Class
+// Every tank class, also the index into the descriptor table below
+enum class TankId : unsigned char {
+    Basic,
+    // Tier 2
+    Twin,
+    Sniper,
+    MachineGun,
+    FlankGuard,
+    // Tier 3
+    TripleShot,
+    QuadTank,
+    TwinFlank,
+    Assassin,
+    Overseer,
+    Hunter,
+    Trapper,
+    Destroyer,
+    Gunner,
+    TriAngle,
+    Auto3,
+    Smasher,
+    Count
+};
+
+// Barrel layout relative to the body radius, angle in degrees
+struct BarrelSpec {
+    float length;
+    float width;
+    float offset;
+    float angle;
+};
+
+// Immutable description of one tank class
+struct TankSpec {
+    const char* name;
+    int tier; // 1, 2, or 3
+    const BarrelSpec* barrels;
+    size_t barrelCount;
+    const TankId* upgrades;
+    size_t upgradeCount;
+};
+
+namespace TankTable {
+// --- Barrels ---
+inline constexpr BarrelSpec basic[] = {{2.2f, 0.8f, 0.0f, 0.0f}};
+inline constexpr BarrelSpec twin[] = {{2.0f, 0.8f, 0.5f, 0.0f}, {2.0f, 0.8f, -0.5f, 0.0f}};
+inline constexpr BarrelSpec sniper[] = {{2.5f, 0.8f, 0.0f, 0.0f}};
+inline constexpr BarrelSpec machineGun[] = {{1.8f, 1.2f, 0.0f, 0.0f}};
+inline constexpr BarrelSpec flankGuard[] = {{2.2f, 0.8f, 0.0f, 0.0f}, {1.8f, 0.8f, 0.0f, 180.0f}};
+inline constexpr BarrelSpec tripleShot[] = {{2.0f, 0.8f, 0.0f, 0.0f}, {1.8f, 0.8f, 0.0f, 45.0f}, {1.8f, 0.8f, 0.0f, -45.0f}};
+inline constexpr BarrelSpec quadTank[] = {{2.0f, 0.8f, 0.0f, 0.0f}, {2.0f, 0.8f, 0.0f, 90.0f}, {2.0f, 0.8f, 0.0f, 180.0f}, {2.0f, 0.8f, 0.0f, 270.0f}};
+inline constexpr BarrelSpec twinFlank[] = {{2.0f, 0.8f, 0.5f, 0.0f}, {2.0f, 0.8f, -0.5f, 0.0f}, {2.0f, 0.8f, 0.5f, 180.0f}, {2.0f, 0.8f, -0.5f, 180.0f}};
+inline constexpr BarrelSpec assassin[] = {{3.0f, 0.8f, 0.0f, 0.0f}};
+inline constexpr BarrelSpec overseer[] = {{1.5f, 1.2f, 0.0f, 90.0f}, {1.5f, 1.2f, 0.0f, -90.0f}};
+inline constexpr BarrelSpec hunter[] = {{2.5f, 0.7f, 0.0f, 0.0f}, {2.0f, 1.0f, 0.0f, 0.0f}};
+inline constexpr BarrelSpec trapper[] = {{1.5f, 1.2f, 0.0f, 0.0f}};
+inline constexpr BarrelSpec destroyer[] = {{2.0f, 1.5f, 0.0f, 0.0f}};
+inline constexpr BarrelSpec gunner[] = {{1.5f, 0.4f, 0.3f, 0.0f}, {1.5f, 0.4f, -0.3f, 0.0f}, {1.8f, 0.4f, 0.6f, 0.0f}, {1.8f, 0.4f, -0.6f, 0.0f}};
+inline constexpr BarrelSpec triAngle[] = {{2.2f, 0.8f, 0.0f, 0.0f}, {1.8f, 0.8f, 0.0f, 150.0f}, {1.8f, 0.8f, 0.0f, 210.0f}};
+inline constexpr BarrelSpec auto3[] = {{1.5f, 0.6f, 0.0f, 0.0f}, {1.5f, 0.6f, 0.0f, 120.0f}, {1.5f, 0.6f, 0.0f, 240.0f}};
+// Smasher has no barrels
+
+// --- Upgrade edges ---
+inline constexpr TankId fromBasic[] = {TankId::Twin, TankId::Sniper, TankId::MachineGun, TankId::FlankGuard};
+inline constexpr TankId fromTwin[] = {TankId::TripleShot, TankId::QuadTank, TankId::TwinFlank};
+inline constexpr TankId fromSniper[] = {TankId::Assassin, TankId::Overseer, TankId::Hunter, TankId::Trapper};
+inline constexpr TankId fromMachineGun[] = {TankId::Destroyer, TankId::Gunner};
+// Quad Tank and Twin Flank are shared with Twin
+inline constexpr TankId fromFlankGuard[] = {TankId::TriAngle, TankId::QuadTank, TankId::TwinFlank, TankId::Auto3};
+
+template <size_t N>
+constexpr size_t count(const BarrelSpec (&)[N]) { return N; }
+template <size_t N>
+constexpr size_t count(const TankId (&)[N]) { return N; }
+
+// Indexed by TankId
+inline constexpr TankSpec specs[] = {
+    {"Basic Tank", 1, basic, count(basic), fromBasic, count(fromBasic)},
+    {"Twin", 2, twin, count(twin), fromTwin, count(fromTwin)},
+    {"Sniper", 2, sniper, count(sniper), fromSniper, count(fromSniper)},
+    {"Machine Gun", 2, machineGun, count(machineGun), fromMachineGun, count(fromMachineGun)},
+    {"Flank Guard", 2, flankGuard, count(flankGuard), fromFlankGuard, count(fromFlankGuard)},
+    {"Triple Shot", 3, tripleShot, count(tripleShot), nullptr, 0},
+    {"Quad Tank", 3, quadTank, count(quadTank), nullptr, 0},
+    {"Twin Flank", 3, twinFlank, count(twinFlank), nullptr, 0},
+    {"Assassin", 3, assassin, count(assassin), nullptr, 0},
+    {"Overseer", 3, overseer, count(overseer), nullptr, 0},
+    {"Hunter", 3, hunter, count(hunter), nullptr, 0},
+    {"Trapper", 3, trapper, count(trapper), nullptr, 0},
+    {"Destroyer", 3, destroyer, count(destroyer), nullptr, 0},
+    {"Gunner", 3, gunner, count(gunner), nullptr, 0},
+    {"Tri-Angle", 3, triAngle, count(triAngle), nullptr, 0},
+    {"Auto 3", 3, auto3, count(auto3), nullptr, 0},
+    {"Smasher", 3, nullptr, 0, nullptr, 0}, // Unique branch
+};
+static_assert(sizeof(specs) / sizeof(specs[0]) == static_cast<size_t>(TankId::Count), "every TankId needs a spec");
+
+constexpr size_t findMaxBarrels() {
+    size_t most = 0;
+    for (const TankSpec& spec : specs)
+        most = spec.barrelCount > most ? spec.barrelCount : most;
+    return most;
+}
+
+constexpr size_t findMaxUpgrades() {
+    size_t most = 0;
+    for (const TankSpec& spec : specs)
+        most = spec.upgradeCount > most ? spec.upgradeCount : most;
+    return most;
+}
+
+// Most barrels any class has, players reserve this many up front
+inline constexpr size_t maxBarrels = findMaxBarrels();
+// Most choices any class offers on the class selection page
+inline constexpr size_t maxUpgrades = findMaxUpgrades();
+}
+
+class TankList;
+
+// Non-owning handle to a tank class, as cheap to copy as the id it wraps
 class Tank {
-public:
-    virtual ~Tank() = default;
-    virtual void configure(Player& p) = 0;
-    virtual std::vector<std::shared_ptr<Tank>> getUpgrades() = 0;
-    virtual std::string getName() = 0;
-    virtual int getTier() = 0; // 1, 2, or 3
-};
-
-// --- Tier 1 ---
-class BasicTank : public Tank {
-public:
-    void configure(Player& p) override;
-    std::vector<std::shared_ptr<Tank>> getUpgrades() override;
-    std::string getName() override { return "Basic Tank"; }
-    int getTier() override { return 1; }
-};
-
-// --- Tier 2 ---
-class Twin : public Tank {
-public:
-    void configure(Player& p) override;
-    std::vector<std::shared_ptr<Tank>> getUpgrades() override;
-    std::string getName() override { return "Twin"; }
-    int getTier() override { return 2; }
-};
-
-class Sniper : public Tank {
-public:
-    void configure(Player& p) override;
-    std::vector<std::shared_ptr<Tank>> getUpgrades() override;
-    std::string getName() override { return "Sniper"; }
-    int getTier() override { return 2; }
-};
-
-class MachineGun : public Tank {
-public:
-    void configure(Player& p) override;
-    std::vector<std::shared_ptr<Tank>> getUpgrades() override;
-    std::string getName() override { return "Machine Gun"; }
-    int getTier() override { return 2; }
-};
-
-class FlankGuard : public Tank {
-public:
-    void configure(Player& p) override;
-    std::vector<std::shared_ptr<Tank>> getUpgrades() override;
-    std::string getName() override { return "Flank Guard"; }
-    int getTier() override { return 2; }
-};
-
-// --- Tier 3 (Inheriting from Tier 2) ---
-
-// From Twin
-class TripleShot : public Twin {
-public:
-    void configure(Player& p) override;
-    std::vector<std::shared_ptr<Tank>> getUpgrades() override;
-    std::string getName() override { return "Triple Shot"; }
-    int getTier() override { return 3; }
-};
+private:
+    TankId id;
 
-class QuadTank : public Twin { // Shared with FlankGuard, picking Twin as primary
 public:
-    void configure(Player& p) override;
-    std::vector<std::shared_ptr<Tank>> getUpgrades() override;
-    std::string getName() override { return "Quad Tank"; }
-    int getTier() override { return 3; }
-};
+    constexpr Tank(TankId tankId = TankId::Basic) : id(tankId) {}
 
-class TwinFlank : public Twin { // Shared with FlankGuard
-public:
-    void configure(Player& p) override;
-    std::vector<std::shared_ptr<Tank>> getUpgrades() override;
-    std::string getName() override { return "Twin Flank"; }
-    int getTier() override { return 3; }
-};
+    constexpr TankId getId() const { return id; }
+    constexpr const TankSpec& getSpec() const { return TankTable::specs[static_cast<size_t>(id)]; }
+    constexpr const char* getName() const { return getSpec().name; }
+    constexpr int getTier() const { return getSpec().tier; }
+    constexpr TankList getUpgrades() const;
 
-// From Sniper
-class Assassin : public Sniper {
-public:
-    void configure(Player& p) override;
-    std::vector<std::shared_ptr<Tank>> getUpgrades() override;
-    std::string getName() override { return "Assassin"; }
-    int getTier() override { return 3; }
-};
+    // Replace the player's barrels with this class's layout
+    void configure(Player& p) const;
 
-class Overseer : public Sniper {
-public:
-    void configure(Player& p) override;
-    std::vector<std::shared_ptr<Tank>> getUpgrades() override;
-    std::string getName() override { return "Overseer"; }
-    int getTier() override { return 3; }
+    constexpr bool operator==(Tank other) const { return id == other.id; }
+    constexpr bool operator!=(Tank other) const { return id != other.id; }
 };
 
-class Hunter : public Sniper {
-public:
-    void configure(Player& p) override;
-    std::vector<std::shared_ptr<Tank>> getUpgrades() override;
-    std::string getName() override { return "Hunter"; }
-    int getTier() override { return 3; }
-};
+// View over the classes a tank can upgrade into
+class TankList {
+private:
+    const TankId* first;
+    size_t count;
 
-class Trapper : public Sniper {
 public:
-    void configure(Player& p) override;
-    std::vector<std::shared_ptr<Tank>> getUpgrades() override;
-    std::string getName() override { return "Trapper"; }
-    int getTier() override { return 3; }
-};
+    constexpr TankList(const TankId* ids, size_t n) : first(ids), count(n) {}
 
-// From MachineGun
-class Destroyer : public MachineGun {
-public:
-    void configure(Player& p) override;
-    std::vector<std::shared_ptr<Tank>> getUpgrades() override;
-    std::string getName() override { return "Destroyer"; }
-    int getTier() override { return 3; }
+    constexpr size_t size() const { return count; }
+    constexpr bool empty() const { return count == 0; }
+    constexpr Tank operator[](size_t i) const { return Tank(first[i]); }
+    constexpr const TankId* begin() const { return first; }
+    constexpr const TankId* end() const { return first + count; }
 };
 
-class Gunner : public MachineGun {
-public:
-    void configure(Player& p) override;
-    std::vector<std::shared_ptr<Tank>> getUpgrades() override;
-    std::string getName() override { return "Gunner"; }
-    int getTier() override { return 3; }
-};
-
-// From FlankGuard
-class TriAngle : public FlankGuard {
-public:
-    void configure(Player& p) override;
-    std::vector<std::shared_ptr<Tank>> getUpgrades() override;
-    std::string getName() override { return "Tri-Angle"; }
-    int getTier() override { return 3; }
-};
-
-class Auto3 : public FlankGuard {
-public:
-    void configure(Player& p) override;
-    std::vector<std::shared_ptr<Tank>> getUpgrades() override;
-    std::string getName() override { return "Auto 3"; }
-    int getTier() override { return 3; }
-};
-
-// Special
-class Smasher : public Tank { // Unique branch
-public:
-    void configure(Player& p) override;
-    std::vector<std::shared_ptr<Tank>> getUpgrades() override;
-    std::string getName() override { return "Smasher"; }
-    int getTier() override { return 3; }
-};
+constexpr TankList Tank::getUpgrades() const {
+    return TankList(getSpec().upgrades, getSpec().upgradeCount);
+}
@@ -0,0 +1,68 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "JobSystem.hpp"
+
+// Per-frame phases declared with the data they read and write. A task waits
+// for every earlier task it conflicts with (write/read, read/write or
+// write/write on the same resource bit), so running the graph gives the same
+// result as running the tasks one by one in the order they were added.
+class TaskGraph
+{
+public:
+    struct Task
+    {
+        const char *name;
+        uint32_t reads;
+        uint32_t writes;
+        std::function<void()> fn;
+        std::vector<int> dependencies;
+        std::vector<int> dependents;
+
+        // Profiler::now() timestamps of the last run
+        uint64_t start = 0;
+        uint64_t end = 0;
+    };
+
+    // Result of a longest-path pass over the graph for a given cost per task
+    struct CriticalPath
+    {
+        std::vector<int> tasks; // In execution order
+        std::vector<double> earliestFinish;
+        std::vector<double> slack; // How much a task could grow before the frame does
+        double length = 0.0;
+        double serialLength = 0.0;
+    };
+
+private:
+    std::vector<Task> tasks;
+
+    // Most tasks that can be ready at once, measured level by level
+    std::vector<int> levels;
+    size_t width = 0;
+
+    // Scheduling state for the run in progress
+    std::unique_ptr<std::atomic<int>[]> waitingOn;
+    std::mutex readyMutex;
+    std::vector<int> ready;
+    std::atomic<size_t> finished{0};
+
+    int takeReadyTask();
+    void runLane(JobSystem &jobs);
+
+public:
+    // Returns the task index, tasks must be added in their serial order
+    int addTask(const char *name, uint32_t reads, uint32_t writes, std::function<void()> fn);
+
+    // Runs every task once, independent tasks overlap on the job system
+    void run(JobSystem &jobs);
+
+    const std::vector<Task> &getTasks() const { return tasks; }
+
+    CriticalPath findCriticalPath(const std::vector<double> &cost) const;
+};
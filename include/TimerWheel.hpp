@@ -0,0 +1,142 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Hierarchical timer wheel counted in simulation ticks. Four levels of 256
+// slots cover the whole 32 bit tick range; a timer sits in the level of the
+// highest byte where its expiry differs from the current tick and drops a
+// level each time the wheel below wraps. Scheduling is O(1) and advancing
+// only touches the slots that come due, so entities without a timer firing
+// this tick cost nothing. Timers due on the same tick fire in the order they
+// were scheduled.
+template <typename T>
+class TimerWheel
+{
+private:
+    static constexpr int levels = 4;
+    static constexpr int slotBits = 8;
+    static constexpr uint32_t slotCount = 1u << slotBits;
+    static constexpr uint32_t slotMask = slotCount - 1;
+    static constexpr uint32_t endOfList = ~0u;
+
+    struct Node
+    {
+        T payload;
+        uint32_t expiry;
+        uint32_t next; // Next node in the same slot, or in the free list
+    };
+
+    struct Slot
+    {
+        uint32_t head = endOfList;
+        uint32_t tail = endOfList;
+    };
+
+    std::vector<Node> nodes;
+    std::vector<Slot> slots; // levels * slotCount
+    uint32_t freeHead = endOfList;
+    uint32_t now = 0;
+    size_t pending = 0;
+
+    Slot &slotFor(uint32_t expiry)
+    {
+        int level = 0;
+        while (level < levels - 1 && (expiry >> (slotBits * (level + 1))) != (now >> (slotBits * (level + 1))))
+            level++;
+        return slots[level * slotCount + ((expiry >> (slotBits * level)) & slotMask)];
+    }
+
+    void link(uint32_t index)
+    {
+        Slot &slot = slotFor(nodes[index].expiry);
+        nodes[index].next = endOfList;
+        if (slot.tail == endOfList)
+            slot.head = index;
+        else
+            nodes[slot.tail].next = index;
+        slot.tail = index;
+    }
+
+    // Move every timer of one upper slot down to where it now belongs
+    void cascade(int level)
+    {
+        Slot &slot = slots[level * slotCount + ((now >> (slotBits * level)) & slotMask)];
+        uint32_t index = slot.head;
+        slot = Slot();
+        while (index != endOfList)
+        {
+            uint32_t next = nodes[index].next;
+            link(index);
+            index = next;
+        }
+    }
+
+public:
+    // Room for capacity pending timers before the node pool has to grow
+    explicit TimerWheel(size_t capacity = 0) : slots(levels * slotCount) { nodes.reserve(capacity); }
+
+    void reserve(size_t capacity) { nodes.reserve(capacity); }
+
+    // Drops every timer and restarts at tick 0
+    void clear()
+    {
+        nodes.clear();
+        slots.assign(levels * slotCount, Slot());
+        freeHead = endOfList;
+        now = 0;
+        pending = 0;
+    }
+
+    // Fires on the advance() that reaches delayTicks past the current tick,
+    // a delay of 0 is treated as 1
+    void schedule(const T &payload, uint32_t delayTicks)
+    {
+        if (delayTicks == 0)
+            delayTicks = 1;
+
+        uint32_t index;
+        if (freeHead != endOfList)
+        {
+            index = freeHead;
+            freeHead = nodes[index].next;
+            nodes[index].payload = payload;
+        }
+        else
+        {
+            index = static_cast<uint32_t>(nodes.size());
+            nodes.push_back(Node{payload, 0, endOfList});
+        }
+        nodes[index].expiry = now + delayTicks;
+        link(index);
+        pending++;
+    }
+
+    // Step one tick and call fire(payload) for every timer due on it. fire
+    // may schedule new timers, which land on later ticks.
+    template <typename Fire>
+    void advance(Fire &&fire)
+    {
+        now++;
+        for (int level = levels - 1; level > 0; level--)
+            if ((now & ((1u << (slotBits * level)) - 1)) == 0)
+                cascade(level);
+
+        Slot &slot = slots[now & slotMask];
+        uint32_t index = slot.head;
+        slot = Slot();
+        while (index != endOfList)
+        {
+            uint32_t next = nodes[index].next;
+            T payload = nodes[index].payload;
+            nodes[index].next = freeHead;
+            freeHead = index;
+            pending--;
+            fire(payload);
+            index = next;
+        }
+    }
+
+    uint32_t getNow() const { return now; }
+    size_t size() const { return pending; }
+};
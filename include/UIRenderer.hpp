@@ -1,25 +1,85 @@
 #pragma once
 #include <SFML/Graphics.hpp>
+#include <vector>
 #include "Player.hpp"
 #include "Upgrade.hpp"
 #include "FakeWindow.hpp"
 #include "UpgradeWindow.hpp"
 #include "GameStats.hpp"
 #include "TankClass.hpp"
+#include "CachedText.hpp"
 
+// Retained-mode UI: text objects live across frames and are only re-laid out
+// when the value they show changes, static upgrade window chrome is drawn
+// once into textures
 class UIRenderer
 {
-public:
-    static void drawWelcomeScreen(sf::RenderWindow &window, const sf::Font &font, const FakeWindow &fw);
-    static void drawGameOverScreen(sf::RenderWindow &window, const sf::Font &font, const GameStats &stats, const FakeWindow &fw);
-    
-    // Updated for Diep.io UI
-    static void drawHUD(sf::RenderWindow &window, const sf::Font &font, const Player &player, const FakeWindow &fw);
-    static void drawUpgradeWindow(sf::RenderWindow &window, const sf::Font &font, Player &player, sf::Vector2i mousePos, UpgradeWindow &uw);
-    
-    // Helper to draw a single stat bar
-    static void drawStatBar(sf::RenderWindow &window, const sf::Font &font, sf::Vector2f pos, std::string label, int level, sf::Color color, bool canUpgrade, sf::Vector2i mousePos, int statIndex, Player &player);
-
 private:
+    const sf::Font &font;
+
+    // Welcome and game over screens
+    CachedText titleText;
+    CachedText startText;
+    CachedText gameOverText;
+    CachedText killsText;
+    CachedText timeText;
+    CachedText restartText;
+
+    // HUD
+    sf::RectangleShape xpBackground;
+    sf::RectangleShape xpFill;
+    CachedText levelText;
+    CachedText tankUpgradeHint;
+
+    // Upgrade window, dynamic parts
+    CachedText pointsText;
+    CachedText tankUpgradeText;
+    CachedText plusGlyph;
+    sf::RectangleShape statFill;
+    sf::RectangleShape statButton;
+    sf::RectangleShape tankUpgradeButton;
+    sf::RectangleShape classBox;
+    std::vector<CachedText> classNames;
+
+    // Upgrade window, static parts of each page. Stat labels sit above the
+    // fill bars so they get their own layer.
+    sf::RenderTexture statsBackground;
+    sf::RenderTexture statsLabels;
+    sf::RenderTexture classChrome;
+    // False if a texture could not be created, chrome is then drawn live
+    bool chromeCached = false;
+
+    // Every tank class drawn once, one cell per TankId
+    sf::RenderTexture previewAtlas;
+    bool previewsCached = false;
+    const int atlasColumns = 6;
+    std::vector<sf::Vertex> previewQuads;
+    BatchRenderer previewFallback;
+
+    void bakeChrome(sf::Vector2f size);
+    void bakePreviews();
+    sf::Vector2f getAtlasCell(Tank tank) const;
+
+    // Textured quad for one preview, or a freshly drawn tank if there is no atlas
+    void addPreview(Tank tank, sf::Vector2f pos);
+    void drawChrome(sf::RenderWindow &window, const sf::RenderTexture &layer, sf::Vector2f pos) const;
+    void drawStatsBackground(sf::RenderTarget &target, sf::Vector2f origin) const;
+    void drawStatsLabels(sf::RenderTarget &target, sf::Vector2f origin) const;
+    void drawClassChrome(sf::RenderTarget &target, sf::Vector2f origin, sf::Vector2f size) const;
+
+    // Fill level and upgrade button of a single stat bar
+    void drawStatBar(sf::RenderWindow &window, sf::Vector2f pos, int level, sf::Color color, bool canUpgrade, sf::Vector2i mousePos);
+
     static void centerText(sf::Text &text, float x, float y);
+
+public:
+    // Bakes all cached layers up front so opening a menu never stalls a frame
+    UIRenderer(const sf::Font &font, sf::Vector2f upgradeWindowSize);
+
+    void drawWelcomeScreen(sf::RenderWindow &window, const FakeWindow &fw);
+    void drawGameOverScreen(sf::RenderWindow &window, const GameStats &stats, const FakeWindow &fw);
+
+    // Updated for Diep.io UI
+    void drawHUD(sf::RenderWindow &window, const Player &player, const FakeWindow &fw);
+    void drawUpgradeWindow(sf::RenderWindow &window, const Player &player, sf::Vector2i mousePos, const UpgradeWindow &uw);
 };
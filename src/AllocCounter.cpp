@@ -0,0 +1,82 @@
+#include "../include/AllocCounter.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    std::atomic<uint64_t> totalAllocations{0};
+    uint64_t frameStart = 0;
+    int64_t budget = -1;
+    bool skipCurrent = false;
+    uint64_t framesOverBudget = 0;
+    uint64_t worstFrame = 0;
+}
+
+#ifdef WINDOWSHOCK_COUNT_ALLOCS
+
+namespace
+{
+    void *countedAlloc(std::size_t size)
+    {
+        totalAllocations.fetch_add(1, std::memory_order_relaxed);
+        if (void *p = std::malloc(size ? size : 1))
+            return p;
+        throw std::bad_alloc();
+    }
+}
+
+void *operator new(std::size_t size) { return countedAlloc(size); }
+void *operator new[](std::size_t size) { return countedAlloc(size); }
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+    totalAllocations.fetch_add(1, std::memory_order_relaxed);
+    return std::malloc(size ? size : 1);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &tag) noexcept { return operator new(size, tag); }
+
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete[](void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void *p, std::size_t) noexcept { std::free(p); }
+
+bool AllocCounter::isEnabled() { return true; }
+
+#else
+
+bool AllocCounter::isEnabled() { return false; }
+
+#endif
+
+uint64_t AllocCounter::getTotal() { return totalAllocations.load(std::memory_order_relaxed); }
+
+uint64_t AllocCounter::endFrame()
+{
+    uint64_t now = getTotal();
+    uint64_t frame = now - frameStart;
+    frameStart = now;
+
+    if (budget >= 0 && !skipCurrent)
+    {
+        if (frame > static_cast<uint64_t>(budget))
+            framesOverBudget++;
+        if (frame > worstFrame)
+            worstFrame = frame;
+    }
+    skipCurrent = false;
+    return frame;
+}
+
+void AllocCounter::skipFrame() { skipCurrent = true; }
+
+void AllocCounter::setBudget(int64_t allocationsPerFrame)
+{
+    budget = allocationsPerFrame;
+    framesOverBudget = 0;
+    worstFrame = 0;
+}
+
+uint64_t AllocCounter::getFramesOverBudget() { return framesOverBudget; }
+uint64_t AllocCounter::getWorstFrame() { return worstFrame; }
@@ -0,0 +1,117 @@
+#include "../include/BatchRenderer.hpp"
+#include <cmath>
+
+BatchRenderer::BatchRenderer()
+{
+    // 30 points matches sf::CircleShape's default for large bodies
+    const size_t pointCounts[3] = {12, 20, 30};
+    for (int level = 0; level < 3; level++)
+    {
+        size_t count = pointCounts[level];
+        for (size_t i = 0; i < count; i++)
+        {
+            // Same starting angle as sf::CircleShape
+            float angle = i * 2.0f * 3.14159265f / count - 3.14159265f / 2.0f;
+            circleTables[level].points.emplace_back(std::cos(angle), std::sin(angle));
+        }
+    }
+}
+
+const BatchRenderer::CircleTable &BatchRenderer::getCircleTable(float radius) const
+{
+    if (radius < 12.0f) return circleTables[0];
+    if (radius < 30.0f) return circleTables[1];
+    return circleTables[2];
+}
+
+sf::Vertex *BatchRenderer::allocate(size_t count)
+{
+    size_t start = vertices.size();
+    vertices.resize(start + count);
+    return vertices.data() + start;
+}
+
+namespace
+{
+    inline sf::Vertex *writeTriangle(sf::Vertex *out, sf::Vector2f a, sf::Vector2f b, sf::Vector2f c, sf::Color color)
+    {
+        out[0] = sf::Vertex{a, color};
+        out[1] = sf::Vertex{b, color};
+        out[2] = sf::Vertex{c, color};
+        return out + 3;
+    }
+
+    inline sf::Vertex *writeQuad(sf::Vertex *out, sf::Vector2f a, sf::Vector2f b, sf::Vector2f c, sf::Vector2f d, sf::Color color)
+    {
+        out = writeTriangle(out, a, b, c, color);
+        return writeTriangle(out, a, c, d, color);
+    }
+}
+
+void BatchRenderer::addCircle(sf::Vector2f center, float radius, sf::Color fill, float outlineThickness, sf::Color outlineColor)
+{
+    const std::vector<sf::Vector2f> &unit = getCircleTable(radius).points;
+    size_t count = unit.size();
+    bool outlined = outlineThickness > 0.0f;
+    float outer = radius + outlineThickness;
+
+    // Fan from the first point for the body, then one quad per edge for the ring
+    sf::Vertex *out = allocate((count - 2) * 3 + (outlined ? count * 6 : 0));
+    sf::Vector2f first = center + unit[0] * radius;
+    for (size_t i = 1; i + 1 < count; i++)
+        out = writeTriangle(out, first, center + unit[i] * radius, center + unit[i + 1] * radius, fill);
+
+    if (!outlined)
+        return;
+
+    sf::Vector2f inner0 = first, outer0 = center + unit[0] * outer;
+    for (size_t i = 1; i <= count; i++)
+    {
+        const sf::Vector2f &p = unit[i == count ? 0 : i];
+        sf::Vector2f inner1 = center + p * radius, outer1 = center + p * outer;
+        out = writeQuad(out, inner0, outer0, outer1, inner1, outlineColor);
+        inner0 = inner1;
+        outer0 = outer1;
+    }
+}
+
+void BatchRenderer::addRect(sf::Vector2f anchor, sf::Vector2f size, float angle, sf::Color fill, float outlineThickness, sf::Color outlineColor)
+{
+    float radAngle = angle * 3.14159f / 180.0f;
+    sf::Vector2f forward(std::cos(radAngle), std::sin(radAngle));
+    sf::Vector2f right(-forward.y, forward.x);
+
+    // Local x runs along the rectangle, local y is centred on the anchor
+    auto corner = [&](float lx, float ly) { return anchor + forward * lx + right * ly; };
+
+    bool outlined = outlineThickness > 0.0f;
+    sf::Vertex *out = allocate(outlined ? 30 : 6);
+
+    float halfH = size.y / 2.0f;
+    sf::Vector2f a = corner(0.0f, -halfH), b = corner(size.x, -halfH);
+    sf::Vector2f c = corner(size.x, halfH), d = corner(0.0f, halfH);
+    out = writeQuad(out, a, b, c, d, fill);
+
+    if (!outlined)
+        return;
+
+    float t = outlineThickness;
+    sf::Vector2f oa = corner(-t, -halfH - t), ob = corner(size.x + t, -halfH - t);
+    sf::Vector2f oc = corner(size.x + t, halfH + t), od = corner(-t, halfH + t);
+    out = writeQuad(out, oa, ob, b, a, outlineColor);
+    out = writeQuad(out, ob, oc, c, b, outlineColor);
+    out = writeQuad(out, oc, od, d, c, outlineColor);
+    writeQuad(out, od, oa, a, d, outlineColor);
+}
+
+void BatchRenderer::flush(sf::RenderTarget &target)
+{
+    if (!vertices.empty())
+        target.draw(vertices.data(), vertices.size(), sf::PrimitiveType::Triangles);
+    clear();
+}
+
+void BatchRenderer::clear()
+{
+    vertices.clear();
+}
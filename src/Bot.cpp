@@ -0,0 +1,105 @@
+#include "../include/Bot.hpp"
+#include "../include/Simulation.hpp"
+#include <cmath>
+
+namespace
+{
+    const int statCount = 8;
+
+    // Closer than this the bot backs off, further away it drifts to the centre
+    const float keepAway = 250.0f;
+}
+
+InputFrame Bot::think(const Simulation &sim, float dt)
+{
+    const Player &player = sim.getPlayer();
+    sf::Vector2f pos = player.getPosition();
+
+    // Nearest enemy
+    const Enemy *target = nullptr;
+    float bestDist = 0.0f;
+    sim.getEnemies().forEach([&](const Enemy &e)
+    {
+        sf::Vector2f d = e.getPosition() - pos;
+        float dist = d.x * d.x + d.y * d.y;
+        if (!target || dist < bestDist)
+        {
+            target = &e;
+            bestDist = dist;
+        }
+    });
+
+    // Change strafing direction every second or two
+    strafeTimer -= dt;
+    if (strafeTimer <= 0.0f)
+    {
+        strafeSign = rng.nextInt(2) == 0 ? -1.0f : 1.0f;
+        strafeTimer = 1.0f + rng.nextFloat();
+    }
+
+    const PlayingWindow &window = sim.getWindow();
+    sf::Vector2f centre((window.getLeft() + window.getRight()) / 2.0f, (window.getTop() + window.getBottom()) / 2.0f);
+
+    InputFrame input;
+    sf::Vector2f move = centre - pos;
+    if (target)
+    {
+        sf::Vector2f d = target->getPosition() - pos;
+        input.fire = true;
+        input.aimPos = target->getPosition();
+
+        // Back away from close enemies and circle around them
+        if (bestDist < keepAway * keepAway)
+            move = -d + sf::Vector2f(-d.y, d.x) * strafeSign;
+    }
+    else
+    {
+        input.aimPos = pos + sf::Vector2f(1.0f, 0.0f);
+    }
+
+    // Same dead zone as a player letting go of a key
+    const float deadZone = 10.0f;
+    input.moveLeft = move.x < -deadZone;
+    input.moveRight = move.x > deadZone;
+    input.moveUp = move.y < -deadZone;
+    input.moveDown = move.y > deadZone;
+    return input;
+}
+
+void Bot::spendPoints(Simulation &sim)
+{
+    const Player &player = sim.getPlayer();
+
+    // Walk the priority list, skipping stats that are maxed out. Focused builds
+    // stay on a stat until it is full, the others move on after every point.
+    int skipped = 0;
+    while (player.skillPoints > 0 && skipped < statCount)
+    {
+        int stat = build.statPriority[nextStat];
+        if (player.statLevels[stat] < 7)
+        {
+            sim.execute(Command{0, CommandType::UpgradeStat, stat});
+            skipped = 0;
+            if (build.focus)
+                continue;
+        }
+        else
+        {
+            skipped++;
+        }
+        nextStat = (nextStat + 1) % statCount;
+    }
+
+    // Same unlock levels as the class selection page
+    int tier = player.currentTank.getTier();
+    TankList upgrades = player.currentTank.getUpgrades();
+    if (upgrades.empty() || !((tier == 1 && player.level >= 10) || (tier == 2 && player.level >= 20)))
+        return;
+
+    TankId wanted = tier == 1 ? build.tier2 : build.tier3;
+    int choice = rng.nextInt(static_cast<int>(upgrades.size()));
+    for (size_t i = 0; i < upgrades.size(); i++)
+        if (upgrades[i].getId() == wanted)
+            choice = static_cast<int>(i);
+    sim.execute(Command{0, CommandType::SelectTank, choice});
+}
@@ -0,0 +1,152 @@
+#include "../include/BulletKernels.hpp"
+#include <cstdint>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64)
+#define WINDOWSHOCK_X86 1
+#include <immintrin.h>
+#endif
+
+namespace
+{
+    void integrateScalar(float *x, float *y, const float *vx, const float *vy, size_t begin, size_t n,
+                         float dt, const WallBounds &bounds, unsigned char *wallMask)
+    {
+        for (size_t i = begin; i < n; i++)
+        {
+            x[i] += vx[i] * dt;
+            y[i] += vy[i] * dt;
+
+            wallMask[i] = static_cast<unsigned char>((x[i] < bounds.left ? WallLeft : 0) |
+                                                     (x[i] > bounds.right ? WallRight : 0) |
+                                                     (y[i] < bounds.top ? WallTop : 0) |
+                                                     (y[i] > bounds.bottom ? WallBottom : 0));
+        }
+    }
+
+#ifdef WINDOWSHOCK_X86
+    // Spreads an 8-bit movemask into one byte per lane, so four compares turn
+    // into a single 64-bit store of per-bullet wall masks
+    struct LaneSpreadTable
+    {
+        uint64_t bytes[256] = {};
+
+        constexpr LaneSpreadTable()
+        {
+            for (int bits = 0; bits < 256; bits++)
+            {
+                for (int lane = 0; lane < 8; lane++)
+                    if (bits & (1 << lane))
+                        bytes[bits] |= uint64_t(1) << (lane * 8);
+            }
+        }
+    };
+
+    constexpr LaneSpreadTable laneSpread;
+
+    inline uint64_t combineMasks(int left, int right, int top, int bottom)
+    {
+        return laneSpread.bytes[left] | (laneSpread.bytes[right] << 1) |
+               (laneSpread.bytes[top] << 2) | (laneSpread.bytes[bottom] << 3);
+    }
+
+    size_t integrateSSE2(float *x, float *y, const float *vx, const float *vy, size_t n,
+                         float dt, const WallBounds &bounds, unsigned char *wallMask)
+    {
+        const __m128 step = _mm_set1_ps(dt);
+        const __m128 left = _mm_set1_ps(bounds.left), right = _mm_set1_ps(bounds.right);
+        const __m128 top = _mm_set1_ps(bounds.top), bottom = _mm_set1_ps(bounds.bottom);
+
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+            __m128 px = _mm_add_ps(_mm_loadu_ps(x + i), _mm_mul_ps(_mm_loadu_ps(vx + i), step));
+            __m128 py = _mm_add_ps(_mm_loadu_ps(y + i), _mm_mul_ps(_mm_loadu_ps(vy + i), step));
+            _mm_storeu_ps(x + i, px);
+            _mm_storeu_ps(y + i, py);
+
+            uint64_t mask = combineMasks(_mm_movemask_ps(_mm_cmplt_ps(px, left)),
+                                         _mm_movemask_ps(_mm_cmpgt_ps(px, right)),
+                                         _mm_movemask_ps(_mm_cmplt_ps(py, top)),
+                                         _mm_movemask_ps(_mm_cmpgt_ps(py, bottom)));
+            uint32_t lanes = static_cast<uint32_t>(mask);
+            std::memcpy(wallMask + i, &lanes, 4);
+        }
+        return i;
+    }
+
+    __attribute__((target("avx2"))) size_t integrateAVX2(float *x, float *y, const float *vx, const float *vy, size_t n,
+                                                         float dt, const WallBounds &bounds, unsigned char *wallMask)
+    {
+        const __m256 step = _mm256_set1_ps(dt);
+        const __m256 left = _mm256_set1_ps(bounds.left), right = _mm256_set1_ps(bounds.right);
+        const __m256 top = _mm256_set1_ps(bounds.top), bottom = _mm256_set1_ps(bounds.bottom);
+
+        size_t i = 0;
+        for (; i + 8 <= n; i += 8)
+        {
+            __m256 px = _mm256_add_ps(_mm256_loadu_ps(x + i), _mm256_mul_ps(_mm256_loadu_ps(vx + i), step));
+            __m256 py = _mm256_add_ps(_mm256_loadu_ps(y + i), _mm256_mul_ps(_mm256_loadu_ps(vy + i), step));
+            _mm256_storeu_ps(x + i, px);
+            _mm256_storeu_ps(y + i, py);
+
+            uint64_t mask = combineMasks(_mm256_movemask_ps(_mm256_cmp_ps(px, left, _CMP_LT_OQ)),
+                                         _mm256_movemask_ps(_mm256_cmp_ps(px, right, _CMP_GT_OQ)),
+                                         _mm256_movemask_ps(_mm256_cmp_ps(py, top, _CMP_LT_OQ)),
+                                         _mm256_movemask_ps(_mm256_cmp_ps(py, bottom, _CMP_GT_OQ)));
+            std::memcpy(wallMask + i, &mask, 8);
+        }
+        return i;
+    }
+#endif
+}
+
+bool isSimdTierSupported(SimdTier tier)
+{
+    switch (tier)
+    {
+    case SimdTier::Scalar:
+        return true;
+#ifdef WINDOWSHOCK_X86
+    case SimdTier::SSE2:
+        return __builtin_cpu_supports("sse2");
+    case SimdTier::AVX2:
+        return __builtin_cpu_supports("avx2");
+#endif
+    default:
+        return false;
+    }
+}
+
+SimdTier detectSimdTier()
+{
+    if (isSimdTierSupported(SimdTier::AVX2)) return SimdTier::AVX2;
+    if (isSimdTierSupported(SimdTier::SSE2)) return SimdTier::SSE2;
+    return SimdTier::Scalar;
+}
+
+const char *getSimdTierName(SimdTier tier)
+{
+    switch (tier)
+    {
+    case SimdTier::SSE2: return "SSE2";
+    case SimdTier::AVX2: return "AVX2";
+    default: return "Scalar";
+    }
+}
+
+void integrateBullets(SimdTier tier, float *x, float *y, const float *vx, const float *vy, size_t n,
+                      float dt, const WallBounds &bounds, unsigned char *wallMask)
+{
+    size_t done = 0;
+
+#ifdef WINDOWSHOCK_X86
+    if (tier == SimdTier::AVX2)
+        done = integrateAVX2(x, y, vx, vy, n, dt, bounds, wallMask);
+    else if (tier == SimdTier::SSE2)
+        done = integrateSSE2(x, y, vx, vy, n, dt, bounds, wallMask);
+#endif
+
+    // Remainder that does not fill a whole vector
+    integrateScalar(x, y, vx, vy, done, n, dt, bounds, wallMask);
+}
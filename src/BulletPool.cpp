@@ -0,0 +1,68 @@
+#include "../include/BulletPool.hpp"
+#include <algorithm>
+
+BulletPool::BulletPool(size_t capacity, BulletOwner sinkOwner)
+    : capacity(capacity), sinkOwner(sinkOwner),
+      x(capacity), y(capacity), prevX(capacity), prevY(capacity), vx(capacity), vy(capacity),
+      radius(capacity), damage(capacity), owner(capacity)
+{
+}
+
+bool BulletPool::spawn(sf::Vector2f pos, sf::Vector2f vel, float r, int dmg, BulletOwner who)
+{
+    if (count == capacity)
+        return false;
+
+    x[count] = prevX[count] = pos.x;
+    y[count] = prevY[count] = pos.y;
+    vx[count] = vel.x;
+    vy[count] = vel.y;
+    radius[count] = r;
+    damage[count] = dmg;
+    owner[count] = who;
+    count++;
+    return true;
+}
+
+void BulletPool::emit(sf::Vector2f pos, sf::Vector2f vel, float r, int dmg)
+{
+    spawn(pos, vel, r, dmg, sinkOwner);
+}
+
+void BulletPool::remove(size_t index)
+{
+    size_t last = --count;
+    if (index == last)
+        return;
+
+    x[index] = x[last];
+    y[index] = y[last];
+    prevX[index] = prevX[last];
+    prevY[index] = prevY[last];
+    vx[index] = vx[last];
+    vy[index] = vy[last];
+    radius[index] = radius[last];
+    damage[index] = damage[last];
+    owner[index] = owner[last];
+}
+
+void BulletPool::clear()
+{
+    count = 0;
+}
+
+void BulletPool::savePreviousState()
+{
+    std::copy(x.begin(), x.begin() + count, prevX.begin());
+    std::copy(y.begin(), y.begin() + count, prevY.begin());
+}
+
+void BulletPool::draw(BatchRenderer &batch, float alpha) const
+{
+    // Same look as a bullet drawn through Entity::draw
+    for (size_t i = 0; i < count; i++)
+    {
+        sf::Vector2f pos(prevX[i] + (x[i] - prevX[i]) * alpha, prevY[i] + (y[i] - prevY[i]) * alpha);
+        batch.addCircle(pos, radius[i], sf::Color::Yellow, 3.0f, sf::Color(85, 85, 85));
+    }
+}
@@ -0,0 +1,45 @@
+#include "../include/CachedText.hpp"
+#include <charconv>
+
+CachedText::CachedText(const sf::Font &font, const std::string &str, unsigned int size, sf::Color color, bool centered)
+    : text(font, str, size), content(str), centered(centered)
+{
+    text.setFillColor(color);
+    relayout();
+}
+
+void CachedText::relayout()
+{
+    if (!centered)
+        return;
+
+    sf::FloatRect bounds = text.getLocalBounds();
+    text.setOrigin(sf::Vector2f(bounds.position.x + bounds.size.x / 2.0f, bounds.position.y + bounds.size.y / 2.0f));
+}
+
+void CachedText::setString(std::string_view str)
+{
+    hasNumber = false;
+    if (str == content)
+        return;
+
+    content.assign(str.data(), str.size());
+    text.setString(content);
+    relayout();
+}
+
+void CachedText::setNumber(const char *prefix, int value, const char *suffix)
+{
+    if (hasNumber && value == number)
+        return;
+
+    char digits[16];
+    std::to_chars_result end = std::to_chars(digits, digits + sizeof(digits), value);
+
+    // Reuses the capacity content already has
+    content.assign(prefix).append(digits, end.ptr).append(suffix);
+    text.setString(content);
+    relayout();
+    number = value;
+    hasNumber = true;
+}
@@ -23,6 +23,14 @@ int Enemy::getCurrencyDrop() const
     return currencyDrop;
 }
 
+void Enemy::applySeparation(sf::Vector2f separation, float dt)
+{
+    // Pixels per second at full overlap, faster than any chase speed so
+    // enemies spread out even while converging on the player
+    const float separationSpeed = 300.0f;
+    setPosition(getPosition() + separation * (separationSpeed * dt));
+}
+
 // --- Triangle Enemy ---
 
 Triangle::Triangle(sf::Vector2f position)
@@ -32,27 +40,26 @@ Triangle::Triangle(sf::Vector2f position)
     setColor(sf::Color(255, 255, 0));
 }
 
-std::vector<Bullet> Triangle::update(sf::Vector2f playerPos, float dt)
+void Triangle::update(const FlowField &flow, sf::Vector2f separation, float dt, BulletSink &out)
 {
     sf::Vector2f pos = getPosition();
-    sf::Vector2f dir = playerPos - pos;
-    float len = std::sqrt(dir.x * dir.x + dir.y * dir.y);
-    sf::Vector2f normDir = (len != 0) ? dir / len : sf::Vector2f(0,0);
+    FlowField::Sample toPlayer = flow.sample(pos);
+    float len = toPlayer.distance;
+    sf::Vector2f normDir = toPlayer.direction;
 
     float currentSpeed = speed;
-    if (len < 150.0f) currentSpeed *= 0.3f; // Reduce speed at close range
+    if (len < FlowField::exactRange) currentSpeed *= 0.3f; // Reduce speed at close range
 
     if (len != 0)
     {
         sf::Vector2f velocity = normDir * currentSpeed;
         setPosition(pos + velocity * dt);
         
-        float angle = std::atan2(normDir.y, normDir.x) * 180.0f / 3.14159f;
-        setRotation(angle);
+        setRotation(toPlayer.angle);
     }
     
+    applySeparation(separation, dt);
     Entity::update(dt);
-    return {};
 }
 
 // --- Circle Enemy ---
@@ -62,45 +69,32 @@ Circle::Circle(sf::Vector2f position)
 {
     setRadius(10.0f);
     setColor(sf::Color(0, 0, 255));
-    moveTimer = 1.0f;
+    firstTimer = 1.0f;
 }
 
-std::vector<Bullet> Circle::update(sf::Vector2f playerPos, float dt)
+void Circle::update(const FlowField &flow, sf::Vector2f separation, float dt, BulletSink &out)
 {
     sf::Vector2f pos = getPosition();
-    sf::Vector2f dir = playerPos - pos;
-    float len = std::sqrt(dir.x * dir.x + dir.y * dir.y);
-    sf::Vector2f normDir = (len != 0) ? dir / len : sf::Vector2f(0,0);
+    FlowField::Sample toPlayer = flow.sample(pos);
+    float len = toPlayer.distance;
+    sf::Vector2f normDir = toPlayer.direction;
 
-    if (isMoving)
-    {
-        moveTimer -= dt;
-        if (moveTimer <= 0.0f)
-        {
-            isMoving = false;
-            stopTimer = 0.5f;
-        }
-        
-        if (len != 0)
-        {
-            sf::Vector2f velocity = normDir * speed;
-            setPosition(pos + velocity * dt);
-            float angle = std::atan2(normDir.y, normDir.x) * 180.0f / 3.14159f;
-            setRotation(angle);
-        }
-    }
-    else
+    if (isMoving && len != 0)
     {
-        stopTimer -= dt;
-        if (stopTimer <= 0.0f)
-        {
-            isMoving = true;
-            moveTimer = 1.0f;
-        }
+        sf::Vector2f velocity = normDir * speed;
+        setPosition(pos + velocity * dt);
+        setRotation(toPlayer.angle);
     }
 
+    applySeparation(separation, dt);
     Entity::update(dt);
-    return {};
+}
+
+float Circle::wake(const FlowField &flow)
+{
+    // Moves for a second, then rests for half
+    isMoving = !isMoving;
+    return isMoving ? 1.0f : 0.5f;
 }
 
 // --- Square Enemy ---
@@ -110,44 +104,36 @@ Square::Square(sf::Vector2f position)
 {
     setRadius(18.0f);
     setColor(sf::Color(0, 255, 0));
-    moveTimer = 2.0f;
+    firstTimer = 2.0f;
 }
 
-std::vector<Bullet> Square::update(sf::Vector2f playerPos, float dt)
+void Square::update(const FlowField &flow, sf::Vector2f separation, float dt, BulletSink &out)
 {
     sf::Vector2f pos = getPosition();
-    sf::Vector2f dir = playerPos - pos;
-    float len = std::sqrt(dir.x * dir.x + dir.y * dir.y);
-    sf::Vector2f normDir = (len != 0) ? dir / len : sf::Vector2f(0,0);
+    FlowField::Sample toPlayer = flow.sample(pos);
 
     if (!isMoving) // Preparation phase
     {
-        moveTimer -= dt;
-        float angle = std::atan2(normDir.y, normDir.x) * 180.0f / 3.14159f;
-        setRotation(angle);
-        
-        if (moveTimer <= 0.0f)
-        {
-            isMoving = true;
-            moveTimer = 0.3f; // Dash duration
-            dashDirection = normDir;
-        }
+        setRotation(toPlayer.angle);
     }
     else // Dashing phase
     {
-        moveTimer -= dt;
         sf::Vector2f velocity = dashDirection * (speed * 3.0f);
         setPosition(pos + velocity * dt);
-        
-        if (moveTimer <= 0.0f)
-        {
-            isMoving = false;
-            moveTimer = 2.0f; // Cooldown duration
-        }
     }
 
+    applySeparation(separation, dt);
     Entity::update(dt);
-    return {};
+}
+
+float Square::wake(const FlowField &flow)
+{
+    isMoving = !isMoving;
+    if (!isMoving)
+        return 2.0f; // Cooldown duration
+
+    dashDirection = flow.sample(getPosition()).direction;
+    return 0.3f; // Dash duration
 }
 
 // --- Spiker (Boss) ---
@@ -164,15 +150,15 @@ Spiker::Spiker(sf::Vector2f position)
         addBarrel(50.0f, 15.0f, 0.0f, i * 45.0f);
     }
     reloadTime = 0.8f;
+    firstTimer = reloadTime;
 }
 
-std::vector<Bullet> Spiker::update(sf::Vector2f playerPos, float dt)
+void Spiker::update(const FlowField &flow, sf::Vector2f separation, float dt, BulletSink &out)
 {
-    std::vector<Bullet> newBullets;
     sf::Vector2f pos = getPosition();
-    sf::Vector2f dir = playerPos - pos;
-    float len = std::sqrt(dir.x * dir.x + dir.y * dir.y);
-    sf::Vector2f normDir = (len != 0) ? dir / len : sf::Vector2f(0,0);
+    FlowField::Sample toPlayer = flow.sample(pos);
+    float len = toPlayer.distance;
+    sf::Vector2f normDir = toPlayer.direction;
 
     // Movement logic
     if (len != 0)
@@ -186,11 +172,7 @@ std::vector<Bullet> Spiker::update(sf::Vector2f playerPos, float dt)
     }
     
     // Shooting logic
-    if (reloadTimer > 0.0f)
-    {
-        reloadTimer -= dt;
-    }
-    else
+    if (readyToFire)
     {
         float baseAngle = getRotation();
         
@@ -207,11 +189,18 @@ std::vector<Bullet> Spiker::update(sf::Vector2f playerPos, float dt)
             sf::Vector2f right(-forward.y, forward.x);
             sf::Vector2f spawnPos = getPosition() + forward * b.length + right * b.offset;
             
-            newBullets.emplace_back(spawnPos, bDir * 200.0f, 15);
+            out.emit(spawnPos, bDir * 200.0f, BulletSink::bulletRadius, 15);
         }
-        reloadTimer = reloadTime;
+        readyToFire = false;
     }
 
+    applySeparation(separation, dt);
     Entity::update(dt);
-    return newBullets;
+}
+
+float Spiker::wake(const FlowField &flow)
+{
+    // The ring goes out on the next update after every reload
+    readyToFire = true;
+    return reloadTime;
 }
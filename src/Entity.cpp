@@ -1,7 +1,7 @@
 #include "../include/Entity.hpp"
 
 Entity::Entity(sf::Vector2f pos, float r, sf::Color col)
-    : position(pos), radius(r), bodyColor(col), rotation(0.0f)
+    : position(pos), previousPosition(pos), previousRotation(0.0f), radius(r), bodyColor(col), rotation(0.0f)
 {
     barrelColor = sf::Color(153, 153, 153);
 }
@@ -11,19 +11,26 @@ void Entity::update(float dt)
     position += velocity * dt;
 }
 
-void Entity::draw(sf::RenderWindow &window)
+void Entity::savePreviousState()
 {
+    previousPosition = position;
+    previousRotation = rotation;
+}
+
+void Entity::draw(BatchRenderer &batch, float alpha) const
+{
+    const sf::Color outlineColor(85, 85, 85);
+
+    // Blend towards the current tick, taking the short way round for rotation
+    sf::Vector2f drawPos = previousPosition + (position - previousPosition) * alpha;
+    float turn = std::remainder(rotation - previousRotation, 360.0f);
+    float drawRotation = previousRotation + turn * alpha;
+
     // Draw barrels first to layer them beneath the body
     for (const auto &b : barrels)
     {
-        sf::RectangleShape barrelShape(sf::Vector2f(b.length, b.width));
-        barrelShape.setOrigin(sf::Vector2f(0.0f, b.width / 2.0f));
-        barrelShape.setFillColor(barrelColor);
-        barrelShape.setOutlineThickness(2.0f);
-        barrelShape.setOutlineColor(sf::Color(85, 85, 85));
-
         // Calculate barrel transform
-        float totalAngle = rotation + b.angle;
+        float totalAngle = drawRotation + b.angle;
         float radAngle = totalAngle * 3.14159f / 180.0f;
         
         // Apply recoil offset
@@ -33,23 +40,13 @@ void Entity::draw(sf::RenderWindow &window)
         sf::Vector2f forward(std::cos(radAngle), std::sin(radAngle));
         sf::Vector2f right(-forward.y, forward.x);
         
-        sf::Vector2f barrelPos = position + right * b.offset - forward * recoilOffset;
-        
-        barrelShape.setPosition(barrelPos);
-        barrelShape.setRotation(sf::degrees(totalAngle));
+        sf::Vector2f barrelPos = drawPos + right * b.offset - forward * recoilOffset;
         
-        window.draw(barrelShape);
+        batch.addRect(barrelPos, sf::Vector2f(b.length, b.width), totalAngle, barrelColor, 2.0f, outlineColor);
     }
 
     // Draw body
-    sf::CircleShape body(radius);
-    body.setOrigin(sf::Vector2f(radius, radius));
-    body.setPosition(position);
-    body.setFillColor(bodyColor);
-    body.setOutlineThickness(3.0f);
-    body.setOutlineColor(sf::Color(85, 85, 85));
-    
-    window.draw(body);
+    batch.addCircle(drawPos, radius, bodyColor, 3.0f, outlineColor);
 }
 
 sf::Vector2f Entity::getPosition() const
@@ -62,6 +59,11 @@ void Entity::setPosition(sf::Vector2f pos)
     position = pos;
 }
 
+sf::Vector2f Entity::getVelocity() const
+{
+    return velocity;
+}
+
 float Entity::getRadius() const
 {
     return radius;
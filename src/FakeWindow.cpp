@@ -12,6 +12,19 @@ FakeWindow::FakeWindow(int sw, int sh, float initialSize)
     currentRight = targetRight = centerX + halfSize;
     currentTop = targetTop = centerY - halfSize;
     currentBottom = targetBottom = centerY + halfSize;
+
+    titleBarShape.setFillColor(sf::Color(45, 45, 48));
+    borderShape.setFillColor(sf::Color::Transparent);
+    borderShape.setOutlineColor(sf::Color(100, 100, 100));
+    borderShape.setOutlineThickness(borderThickness);
+
+    // Close, maximize, minimize
+    const sf::Color buttonColors[3] = {sf::Color(255, 95, 86), sf::Color(40, 201, 64), sf::Color(255, 189, 46)};
+    for (int i = 0; i < 3; i++)
+    {
+        buttonShapes[i].setRadius(6.0f);
+        buttonShapes[i].setFillColor(buttonColors[i]);
+    }
 }
 
 void FakeWindow::resize(float newSize)
@@ -113,52 +126,56 @@ sf::Vector2f FakeWindow::getSize() const { return sf::Vector2f(getWidth(), getHe
 
 bool FakeWindow::isAnimationComplete() const { return !isAnimating; }
 
-void FakeWindow::draw(sf::RenderWindow &window, const sf::Font &font)
+void FakeWindow::drawFrame(sf::RenderWindow &window, const sf::Font &font, sf::FloatRect area, const char *title, sf::Color background)
 {
-    float w = getWidth();
-    float h = getHeight();
-    float x = currentLeft;
-    float y = currentTop - titleBarHeight;
+    float w = area.size.x;
+    float h = area.size.y;
+    float x = area.position.x;
+    float y = area.position.y - titleBarHeight;
 
     // Title bar
-    sf::RectangleShape titleBar(sf::Vector2f(w, titleBarHeight));
-    titleBar.setPosition(sf::Vector2f(x, y));
-    titleBar.setFillColor(sf::Color(45, 45, 48));
-    window.draw(titleBar);
+    titleBarShape.setSize(sf::Vector2f(w, titleBarHeight));
+    titleBarShape.setPosition(sf::Vector2f(x, y));
+    window.draw(titleBarShape);
 
     // Title text
-    sf::Text titleText(font, "WindowShock Game", 14);
-    titleText.setFillColor(sf::Color::White);
-    titleText.setPosition(sf::Vector2f(x + 10, y + 7));
-    window.draw(titleText);
+    if (!titleText)
+    {
+        titleText.emplace(font, title, 14);
+        titleText->setFillColor(sf::Color::White);
+        shownTitle = title;
+    }
+    else if (shownTitle != title)
+    {
+        titleText->setString(title);
+        shownTitle = title;
+    }
+    titleText->setPosition(sf::Vector2f(x + 10, y + 7));
+    window.draw(*titleText);
 
     // Window controls
     float buttonSize = 12.0f;
     float buttonY = y + titleBarHeight / 2.0f - buttonSize / 2.0f;
-
-    auto drawBtn = [&](float offsetX, sf::Color col)
+    const float buttonOffsets[3] = {15.0f, 35.0f, 55.0f};
+    for (int i = 0; i < 3; i++)
     {
-        sf::CircleShape btn(buttonSize / 2.0f);
-        btn.setPosition(sf::Vector2f(x + w - offsetX - buttonSize, buttonY));
-        btn.setFillColor(col);
-        window.draw(btn);
-    };
-
-    drawBtn(15, sf::Color(255, 95, 86));   // Close
-    drawBtn(35, sf::Color(40, 201, 64));   // Maximize
-    drawBtn(55, sf::Color(255, 189, 46));  // Minimize
+        buttonShapes[i].setPosition(sf::Vector2f(x + w - buttonOffsets[i] - buttonSize, buttonY));
+        window.draw(buttonShapes[i]);
+    }
 
     // Game area background
-    sf::RectangleShape gameArea(sf::Vector2f(w, h));
-    gameArea.setPosition(sf::Vector2f(currentLeft, currentTop));
-    gameArea.setFillColor(sf::Color::Black);
-    window.draw(gameArea);
+    areaShape.setSize(sf::Vector2f(w, h));
+    areaShape.setPosition(area.position);
+    areaShape.setFillColor(background);
+    window.draw(areaShape);
 
     // Window border
-    sf::RectangleShape border(sf::Vector2f(w, h + titleBarHeight));
-    border.setPosition(sf::Vector2f(x, y));
-    border.setFillColor(sf::Color::Transparent);
-    border.setOutlineColor(sf::Color(100, 100, 100));
-    border.setOutlineThickness(borderThickness);
-    window.draw(border);
+    borderShape.setSize(sf::Vector2f(w, h + titleBarHeight));
+    borderShape.setPosition(sf::Vector2f(x, y));
+    window.draw(borderShape);
+}
+
+void FakeWindow::draw(sf::RenderWindow &window, const sf::Font &font)
+{
+    drawFrame(window, font, sf::FloatRect(getPosition(), getSize()), "WindowShock Game", sf::Color::Black);
 }
@@ -0,0 +1,143 @@
+#include "../include/FlowField.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    const float radToDeg = 180.0f / 3.14159f;
+
+    // Entry points sit this far inside the walls so enemies actually cross them
+    const float entryInset = 8.0f;
+
+    float distanceBetween(sf::Vector2f from, sf::Vector2f to)
+    {
+        sf::Vector2f d = to - from;
+        return std::sqrt(d.x * d.x + d.y * d.y);
+    }
+
+    FlowField::Sample towards(sf::Vector2f from, sf::Vector2f to)
+    {
+        sf::Vector2f d = to - from;
+        float len = std::sqrt(d.x * d.x + d.y * d.y);
+        if (len == 0.0f)
+            return {sf::Vector2f(0.0f, 0.0f), 0.0f, 0.0f};
+        return {d / len, len, std::atan2(d.y, d.x) * radToDeg};
+    }
+}
+
+FlowField::FlowField(sf::Vector2f worldSize, float cellSize)
+    : cellSize(cellSize), invCellSize(1.0f / cellSize),
+      nearCells(static_cast<int>(std::ceil(exactRange * invCellSize)))
+{
+    columns = std::max(1, static_cast<int>(std::ceil(worldSize.x * invCellSize)));
+    rows = std::max(1, static_cast<int>(std::ceil(worldSize.y * invCellSize)));
+    cells.resize(static_cast<size_t>(columns) * rows);
+    columnMoved.resize(columns);
+}
+
+int FlowField::cellX(float x) const
+{
+    return std::clamp(static_cast<int>(std::floor(x * invCellSize)), 0, columns - 1);
+}
+
+int FlowField::cellY(float y) const
+{
+    return std::clamp(static_cast<int>(std::floor(y * invCellSize)), 0, rows - 1);
+}
+
+void FlowField::update(sf::Vector2f playerPos, const WallBounds &walls, size_t samplers)
+{
+    target = playerPos;
+
+    int px = cellX(playerPos.x), py = cellY(playerPos.y);
+    int wallCells[4] = {cellX(walls.left), cellX(walls.right), cellY(walls.top), cellY(walls.bottom)};
+    bool playerMoved = px != targetCellX || py != targetCellY;
+    if (playerMoved || !std::equal(wallCells, wallCells + 4, boundsCells))
+    {
+        float oldLeft = entryLeft, oldRight = entryRight, oldTop = entryTop, oldBottom = entryBottom;
+        targetCellX = px;
+        targetCellY = py;
+        std::copy(wallCells, wallCells + 4, boundsCells);
+
+        // Cells head for the centre of the player's cell, the last stretch is
+        // steered exactly in sample()
+        goal = sf::Vector2f((targetCellX + 0.5f) * cellSize, (targetCellY + 0.5f) * cellSize);
+
+        // Play area in whole cells, so moving walls only matter once they cross a cell
+        entryLeft = boundsCells[0] * cellSize + entryInset;
+        entryRight = (boundsCells[1] + 1) * cellSize - entryInset;
+        entryTop = boundsCells[2] * cellSize + entryInset;
+        entryBottom = (boundsCells[3] + 1) * cellSize - entryInset;
+
+        if (cellsValid && !playerMoved && samplers * 2 >= cells.size())
+            refreshOutside(oldLeft, oldRight, oldTop, oldBottom);
+        else
+            cellsValid = false;
+    }
+
+    if (!cellsValid && samplers * 2 >= cells.size())
+        rebuild();
+}
+
+FlowField::Cell FlowField::computeCell(int x, int y) const
+{
+    sf::Vector2f centre((x + 0.5f) * cellSize, (y + 0.5f) * cellSize);
+
+    // The play area is a rectangle, so from inside it the straight line is
+    // the shortest path. Outside, enter at the closest point.
+    sf::Vector2f entry(std::clamp(centre.x, entryLeft, entryRight), std::clamp(centre.y, entryTop, entryBottom));
+    Sample s;
+    if (entry == centre)
+    {
+        s = towards(centre, goal);
+    }
+    else
+    {
+        s = towards(centre, entry);
+        s.distance += distanceBetween(entry, goal);
+    }
+    return {s.direction.x, s.direction.y, s.distance, s.angle};
+}
+
+void FlowField::rebuild()
+{
+    rebuildCount++;
+    updatedCells += cells.size();
+    for (int y = 0; y < rows; y++)
+        for (int x = 0; x < columns; x++)
+            cells[static_cast<size_t>(y) * columns + x] = computeCell(x, y);
+    cellsValid = true;
+}
+
+void FlowField::refreshOutside(float oldLeft, float oldRight, float oldTop, float oldBottom)
+{
+    // The goal is unchanged, so a cell only changes if its entry point does:
+    // its column now clamps to a different x, or its row to a different y
+    for (int x = 0; x < columns; x++)
+    {
+        float centre = (x + 0.5f) * cellSize;
+        columnMoved[x] = std::clamp(centre, oldLeft, oldRight) != std::clamp(centre, entryLeft, entryRight);
+    }
+    for (int y = 0; y < rows; y++)
+    {
+        float centre = (y + 0.5f) * cellSize;
+        bool rowMoved = std::clamp(centre, oldTop, oldBottom) != std::clamp(centre, entryTop, entryBottom);
+        for (int x = 0; x < columns; x++)
+        {
+            if (!rowMoved && !columnMoved[x])
+                continue;
+            cells[static_cast<size_t>(y) * columns + x] = computeCell(x, y);
+            updatedCells++;
+        }
+    }
+}
+
+FlowField::Sample FlowField::sample(sf::Vector2f pos) const
+{
+    int x = cellX(pos.x), y = cellY(pos.y);
+    if (std::abs(x - targetCellX) <= nearCells && std::abs(y - targetCellY) <= nearCells)
+        return towards(pos, target);
+
+    Cell c = cellsValid ? cells[static_cast<size_t>(y) * columns + x] : computeCell(x, y);
+    return {sf::Vector2f(c.dirX, c.dirY), c.distance, c.angle};
+}
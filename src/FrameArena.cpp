@@ -0,0 +1,53 @@
+#include "../include/FrameArena.hpp"
+#include <cstdint>
+
+FrameArena::FrameArena(size_t capacity, std::pmr::memory_resource *upstream)
+    : buffer(new std::byte[capacity]), capacity(capacity), upstream(upstream)
+{
+}
+
+FrameArena::~FrameArena()
+{
+    reset();
+}
+
+void *FrameArena::do_allocate(size_t bytes, size_t alignment)
+{
+    uintptr_t base = reinterpret_cast<uintptr_t>(buffer.get());
+    uintptr_t aligned = (base + used + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+    size_t end = static_cast<size_t>(aligned - base) + bytes;
+
+    void *p;
+    if (end <= capacity)
+    {
+        used = end;
+        p = reinterpret_cast<void *>(aligned);
+    }
+    else
+    {
+        // Out of room, the block is remembered so reset() can return it
+        p = upstream->allocate(bytes, alignment);
+        Overflow *header = static_cast<Overflow *>(upstream->allocate(sizeof(Overflow), alignof(Overflow)));
+        *header = Overflow{overflow, p, bytes, alignment};
+        overflow = header;
+        overflowBytes += bytes;
+        overflowCount++;
+    }
+
+    if (getUsed() > peak)
+        peak = getUsed();
+    return p;
+}
+
+void FrameArena::reset()
+{
+    while (overflow)
+    {
+        Overflow *next = overflow->next;
+        upstream->deallocate(overflow->block, overflow->bytes, overflow->alignment);
+        upstream->deallocate(overflow, sizeof(Overflow), alignof(Overflow));
+        overflow = next;
+    }
+    used = 0;
+    overflowBytes = 0;
+}
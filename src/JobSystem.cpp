@@ -0,0 +1,138 @@
+#include "../include/JobSystem.hpp"
+
+namespace
+{
+// Which system and queue the current thread works for, if it is a worker
+thread_local const JobSystem *workerOwner = nullptr;
+thread_local size_t workerQueue = 0;
+}
+
+bool JobSystem::WorkQueue::push(const Job &job)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (count == capacity)
+        return false;
+    jobs[(head + count) % capacity] = job;
+    count++;
+    return true;
+}
+
+bool JobSystem::WorkQueue::popBack(Job &job)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (count == 0)
+        return false;
+    count--;
+    job = jobs[(head + count) % capacity];
+    return true;
+}
+
+bool JobSystem::WorkQueue::popFront(Job &job)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (count == 0)
+        return false;
+    job = jobs[head];
+    head = (head + 1) % capacity;
+    count--;
+    return true;
+}
+
+JobSystem::JobSystem(unsigned workerThreads)
+    : queues(new WorkQueue[workerThreads + 1]), queueCount(workerThreads + 1)
+{
+    workers.reserve(workerThreads);
+    for (unsigned i = 0; i < workerThreads; i++)
+        workers.emplace_back(&JobSystem::workerLoop, this, static_cast<size_t>(i));
+}
+
+JobSystem::~JobSystem()
+{
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (std::thread &t : workers)
+        t.join();
+}
+
+unsigned JobSystem::getDefaultWorkerCount()
+{
+    unsigned cores = std::thread::hardware_concurrency();
+    return cores > 1 ? cores - 1 : 0;
+}
+
+bool JobSystem::tryRunJob(size_t self)
+{
+    Job job;
+    bool found = queues[self].popBack(job);
+
+    // Steal, starting with the next queue so thieves spread out
+    for (size_t i = 1; !found && i < queueCount; i++)
+        found = queues[(self + i) % queueCount].popFront(job);
+
+    if (!found)
+        return false;
+
+    queuedJobs.fetch_sub(1, std::memory_order_relaxed);
+    job.fn(job.context, job.chunk);
+    job.pending->fetch_sub(1, std::memory_order_release);
+    return true;
+}
+
+size_t JobSystem::getOwnQueue() const
+{
+    return workerOwner == this ? workerQueue : queueCount - 1;
+}
+
+void JobSystem::workerLoop(size_t index)
+{
+    workerOwner = this;
+    workerQueue = index;
+
+    while (true)
+    {
+        if (tryRunJob(index))
+            continue;
+
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        wake.wait(lock, [&] { return stopping || queuedJobs.load(std::memory_order_relaxed) > 0; });
+        if (stopping)
+            return;
+    }
+}
+
+void JobSystem::run(ChunkFn fn, void *context, size_t chunks)
+{
+    std::atomic<size_t> pending{chunks};
+    size_t self = getOwnQueue();
+
+    // Deal chunks out round-robin, a full queue means the caller runs it now
+    for (size_t chunk = 0; chunk < chunks; chunk++)
+    {
+        Job job{fn, context, chunk, &pending};
+        if (queues[chunk % queueCount].push(job))
+        {
+            queuedJobs.fetch_add(1, std::memory_order_relaxed);
+        }
+        else
+        {
+            fn(context, chunk);
+            pending.fetch_sub(1, std::memory_order_release);
+        }
+    }
+
+    // Taking the lock orders the new jobs before any worker's sleep check
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+    }
+    wake.notify_all();
+
+    // Help out until every chunk is done
+    while (pending.load(std::memory_order_acquire) > 0)
+    {
+        if (!tryRunJob(self))
+            std::this_thread::yield();
+    }
+}
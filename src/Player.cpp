@@ -8,20 +8,23 @@ Player::Player(float radius, float speed, float startX, float startY)
 {
     recalculateStats();
     currentHealth = currentMaxHealth;
-    setTank(std::make_shared<BasicTank>());
+
+    // Switching class later only rewrites barrels in place
+    barrels.reserve(TankTable::maxBarrels);
+    setTank(TankId::Basic);
 }
 
-void Player::setTank(std::shared_ptr<Tank> newTank)
+void Player::setTank(Tank newTank)
 {
     currentTank = newTank;
-    currentTank->configure(*this);
+    currentTank.configure(*this);
 }
 
 void Player::recalculateStats()
 {
     // Initialize stats with base values and level multipliers
     currentMaxHealth = 100.0f + (statLevels[1] * 20.0f);
-    currentHealthRegen = 0.05f + (statLevels[0] * 0.05f);
+    currentHealthRegen = 3.0f + (statLevels[0] * 3.0f); // Per second
     currentBodyDamage = 20.0f + (statLevels[2] * 5.0f);
     
     currentBulletSpeed = 800.0f + (statLevels[3] * 50.0f);
@@ -32,17 +35,17 @@ void Player::recalculateStats()
     currentMovementSpeed = 300.0f + (statLevels[7] * 20.0f);
 }
 
-void Player::handleInput()
+void Player::handleInput(const InputFrame &input)
 {
     velocity = sf::Vector2f(0.0f, 0.0f);
 
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::W))
+    if (input.moveUp)
         velocity.y -= currentMovementSpeed;
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::S))
+    if (input.moveDown)
         velocity.y += currentMovementSpeed;
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::A))
+    if (input.moveLeft)
         velocity.x -= currentMovementSpeed;
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::D))
+    if (input.moveRight)
         velocity.x += currentMovementSpeed;
 }
 
@@ -53,7 +56,7 @@ void Player::update(float dt)
     // Regenerate health
     if (currentHealth < currentMaxHealth)
     {
-        currentHealth += currentHealthRegen;
+        currentHealth += currentHealthRegen * dt;
         if (currentHealth > currentMaxHealth) currentHealth = currentMaxHealth;
     }
     
@@ -77,10 +80,8 @@ void Player::constrainToWindow(const FakeWindow &fw)
     setPosition(pos);
 }
 
-std::vector<Bullet> Player::createBullets(sf::Vector2f targetPos)
+void Player::createBullets(sf::Vector2f targetPos, BulletSink &out)
 {
-    std::vector<Bullet> newBullets;
-    
     sf::Vector2f pos = getPosition();
     sf::Vector2f dirToMouse = targetPos - pos;
     float len = std::sqrt(dirToMouse.x * dirToMouse.x + dirToMouse.y * dirToMouse.y);
@@ -109,10 +110,8 @@ std::vector<Bullet> Player::createBullets(sf::Vector2f targetPos)
         
         sf::Vector2f spawnPos = pos + forward * (b.length) + right * b.offset;
         
-        newBullets.emplace_back(spawnPos, dir * currentBulletSpeed, static_cast<int>(currentBulletDamage));
+        out.emit(spawnPos, dir * currentBulletSpeed, BulletSink::bulletRadius, static_cast<int>(currentBulletDamage));
     }
-    
-    return newBullets;
 }
 
 void Player::earnXp(int amount)
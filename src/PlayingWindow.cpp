@@ -27,19 +27,20 @@ void PlayingWindow::update(float dt)
     }
 
     // Interpolate wall positions
+    float maxStep = expandSpeed * dt;
     auto moveTowards = [&](float &current, float target)
     {
-        if (std::abs(current - target) < expandSpeed)
+        if (std::abs(current - target) < maxStep)
         {
             current = target;
         }
         else if (current < target)
         {
-            current += expandSpeed;
+            current += maxStep;
         }
         else
         {
-            current -= expandSpeed;
+            current -= maxStep;
         }
     };
 
@@ -0,0 +1,215 @@
+#include "../include/Profiler.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+    enum class RecordKind : uint8_t
+    {
+        Zone,
+        Counter
+    };
+
+    struct Record
+    {
+        uint64_t start;
+        uint64_t value; // Duration in ns for zones, value for counters
+        uint32_t frame;
+        uint16_t id;
+        uint8_t thread;
+        RecordKind kind;
+    };
+
+    // Power of two so the write cursor wraps with a mask
+    const size_t ringSize = 1 << 16;
+    const size_t historySize = 4096;
+
+    struct ProfilerState
+    {
+        std::atomic<bool> enabled{true};
+
+        std::mutex registryMutex;
+        const char *zoneNames[Profiler::maxZones] = {};
+        const char *counterNames[Profiler::maxCounters] = {};
+        int zoneCount = 0;
+        int counterCount = 0;
+
+        std::vector<Record> ring = std::vector<Record>(ringSize);
+        std::atomic<uint64_t> writeCursor{0};
+        std::atomic<uint32_t> frame{0};
+
+        // Per-frame totals, folded into the history ring by endFrame()
+        std::atomic<uint64_t> frameTotals[Profiler::maxZones] = {};
+        std::vector<uint64_t> history = std::vector<uint64_t>(Profiler::maxZones * historySize);
+        size_t historyFrames = 0;
+
+        std::atomic<int> threadCount{0};
+    };
+
+    ProfilerState &state()
+    {
+        static ProfilerState instance;
+        return instance;
+    }
+
+    uint8_t threadIndex()
+    {
+        thread_local uint8_t index = static_cast<uint8_t>(state().threadCount.fetch_add(1));
+        return index;
+    }
+
+    void push(const Record &r)
+    {
+        ProfilerState &s = state();
+        uint64_t slot = s.writeCursor.fetch_add(1, std::memory_order_relaxed) & (ringSize - 1);
+        s.ring[slot] = r;
+    }
+}
+
+int Profiler::registerZone(const char *name)
+{
+    ProfilerState &s = state();
+    std::lock_guard<std::mutex> lock(s.registryMutex);
+    if (s.zoneCount == maxZones)
+        return maxZones - 1;
+    s.zoneNames[s.zoneCount] = name;
+    return s.zoneCount++;
+}
+
+int Profiler::registerCounter(const char *name)
+{
+    ProfilerState &s = state();
+    std::lock_guard<std::mutex> lock(s.registryMutex);
+    if (s.counterCount == maxCounters)
+        return maxCounters - 1;
+    s.counterNames[s.counterCount] = name;
+    return s.counterCount++;
+}
+
+uint64_t Profiler::now()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now().time_since_epoch())
+                                     .count());
+}
+
+void Profiler::setEnabled(bool enabled)
+{
+    state().enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool Profiler::isEnabled()
+{
+    return state().enabled.load(std::memory_order_relaxed);
+}
+
+void Profiler::record(int zone, uint64_t startNs, uint64_t endNs)
+{
+    ProfilerState &s = state();
+    uint64_t duration = endNs - startNs;
+    s.frameTotals[zone].fetch_add(duration, std::memory_order_relaxed);
+    push({startNs, duration, s.frame.load(std::memory_order_relaxed), static_cast<uint16_t>(zone), threadIndex(), RecordKind::Zone});
+}
+
+void Profiler::setCounter(int counter, int64_t value)
+{
+    if (!isEnabled())
+        return;
+
+    ProfilerState &s = state();
+    push({now(), static_cast<uint64_t>(value), s.frame.load(std::memory_order_relaxed), static_cast<uint16_t>(counter), threadIndex(), RecordKind::Counter});
+}
+
+void Profiler::endFrame()
+{
+    ProfilerState &s = state();
+    if (!isEnabled())
+        return;
+
+    size_t row = s.historyFrames % historySize;
+    for (int z = 0; z < maxZones; z++)
+        s.history[z * historySize + row] = s.frameTotals[z].exchange(0, std::memory_order_relaxed);
+
+    s.historyFrames++;
+    s.frame.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool Profiler::writeChromeTrace(const std::string &path)
+{
+    ProfilerState &s = state();
+    std::ofstream out(path);
+    if (!out)
+        return false;
+
+    uint64_t end = s.writeCursor.load();
+    uint64_t begin = end > ringSize ? end - ringSize : 0;
+
+    // Timestamps are relative to the oldest record, in microseconds
+    uint64_t origin = UINT64_MAX;
+    for (uint64_t i = begin; i < end; i++)
+        origin = std::min(origin, s.ring[i & (ringSize - 1)].start);
+
+    out << "{\"traceEvents\":[\n";
+    bool first = true;
+    for (uint64_t i = begin; i < end; i++)
+    {
+        const Record &r = s.ring[i & (ringSize - 1)];
+        out << (first ? "" : ",\n");
+        first = false;
+
+        double ts = (r.start - origin) / 1000.0;
+        if (r.kind == RecordKind::Zone)
+        {
+            out << "{\"name\":\"" << s.zoneNames[r.id] << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << int(r.thread)
+                << ",\"ts\":" << std::fixed << std::setprecision(3) << ts << ",\"dur\":" << r.value / 1000.0
+                << ",\"args\":{\"frame\":" << r.frame << "}}";
+        }
+        else
+        {
+            out << "{\"name\":\"" << s.counterNames[r.id] << "\",\"ph\":\"C\",\"pid\":0,\"tid\":" << int(r.thread)
+                << ",\"ts\":" << std::fixed << std::setprecision(3) << ts
+                << ",\"args\":{\"value\":" << static_cast<int64_t>(r.value) << "}}";
+        }
+    }
+    out << "\n]}\n";
+    return true;
+}
+
+void Profiler::printSummary(std::ostream &out)
+{
+    ProfilerState &s = state();
+    size_t frames = std::min(s.historyFrames, historySize);
+
+    // Percentiles only cover the frames a zone ran on, the frames column says
+    // how many that was so occasional zones are not mistaken for steady ones
+    out << "Frame profile over the last " << frames << " frames (microseconds per frame the zone ran)\n";
+    out << std::left << std::setw(24) << "zone" << std::right << std::setw(10) << "frames" << std::setw(10) << "p50"
+        << std::setw(10) << "p95" << std::setw(10) << "p99" << std::setw(10) << "max" << "\n";
+
+    std::vector<uint64_t> samples;
+    for (int z = 0; z < s.zoneCount; z++)
+    {
+        samples.clear();
+        for (size_t f = 0; f < frames; f++)
+        {
+            uint64_t v = s.history[z * historySize + f];
+            if (v > 0)
+                samples.push_back(v);
+        }
+        if (samples.empty())
+            continue;
+
+        std::sort(samples.begin(), samples.end());
+        auto percentile = [&](double p) { return samples[std::min(samples.size() - 1, static_cast<size_t>(p * samples.size()))] / 1000.0; };
+
+        out << std::left << std::setw(24) << s.zoneNames[z] << std::right << std::setw(10) << samples.size()
+            << std::fixed << std::setprecision(1) << std::setw(10) << percentile(0.50) << std::setw(10) << percentile(0.95) << std::setw(10) << percentile(0.99)
+            << std::setw(10) << samples.back() / 1000.0 << "\n";
+    }
+}
@@ -0,0 +1,182 @@
+#include "../include/Replay.hpp"
+#include <cmath>
+#include <cstring>
+#include <fstream>
+
+namespace
+{
+const char fileMagic[4] = {'W', 'S', 'R', 'P'};
+// Bumped whenever a gameplay change makes old recordings play out differently
+// (2: swept bullet collisions, 3: flow field steering, 4: enemy separation,
+// 5: reduced rate far from the window, 6: timer wheel, 7: exact steering
+// within 150 px of the player)
+const uint32_t fileVersion = 7;
+
+// Input bits packed into one byte per frame
+enum InputBit : unsigned char
+{
+    InputUp = 1,
+    InputDown = 2,
+    InputLeft = 4,
+    InputRight = 8,
+    InputFire = 16
+};
+
+// Bytes one frame and one command take on disk
+const uint64_t frameBytes = 1 + 4 + 4;
+const uint64_t commandBytes = 4 + 1 + 4;
+
+void writeU8(std::ostream &out, uint8_t v)
+{
+    out.put(static_cast<char>(v));
+}
+
+void writeU32(std::ostream &out, uint32_t v)
+{
+    for (int i = 0; i < 4; i++)
+        writeU8(out, static_cast<uint8_t>(v >> (i * 8)));
+}
+
+void writeU64(std::ostream &out, uint64_t v)
+{
+    writeU32(out, static_cast<uint32_t>(v));
+    writeU32(out, static_cast<uint32_t>(v >> 32));
+}
+
+void writeF32(std::ostream &out, float v)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &v, sizeof(bits));
+    writeU32(out, bits);
+}
+
+uint8_t readU8(std::istream &in)
+{
+    return static_cast<uint8_t>(in.get());
+}
+
+uint32_t readU32(std::istream &in)
+{
+    uint32_t v = 0;
+    for (int i = 0; i < 4; i++)
+        v |= static_cast<uint32_t>(readU8(in)) << (i * 8);
+    return v;
+}
+
+uint64_t readU64(std::istream &in)
+{
+    uint64_t low = readU32(in);
+    uint64_t high = readU32(in);
+    return low | (high << 32);
+}
+
+float readF32(std::istream &in)
+{
+    uint32_t bits = readU32(in);
+    float v;
+    std::memcpy(&v, &bits, sizeof(v));
+    return v;
+}
+}
+
+void Replay::clear()
+{
+    frames.clear();
+    commands.clear();
+    finalChecksum = 0;
+}
+
+bool Replay::save(const std::string &path) const
+{
+    std::ofstream out(path, std::ios::binary);
+    if (!out)
+        return false;
+
+    out.write(fileMagic, sizeof(fileMagic));
+    writeU32(out, fileVersion);
+    writeU64(out, seed);
+    writeF32(out, tickRate);
+    writeU32(out, static_cast<uint32_t>(screenWidth));
+    writeU32(out, static_cast<uint32_t>(screenHeight));
+    writeF32(out, initialSize);
+    writeU64(out, finalChecksum);
+
+    writeU32(out, static_cast<uint32_t>(frames.size()));
+    for (const InputFrame &f : frames)
+    {
+        uint8_t bits = 0;
+        if (f.moveUp) bits |= InputUp;
+        if (f.moveDown) bits |= InputDown;
+        if (f.moveLeft) bits |= InputLeft;
+        if (f.moveRight) bits |= InputRight;
+        if (f.fire) bits |= InputFire;
+        writeU8(out, bits);
+        writeF32(out, f.aimPos.x);
+        writeF32(out, f.aimPos.y);
+    }
+
+    writeU32(out, static_cast<uint32_t>(commands.size()));
+    for (const Command &c : commands)
+    {
+        writeU32(out, c.tick);
+        writeU8(out, static_cast<uint8_t>(c.type));
+        writeU32(out, static_cast<uint32_t>(c.value));
+    }
+
+    return static_cast<bool>(out);
+}
+
+bool Replay::load(const std::string &path)
+{
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in)
+        return false;
+    const std::streamoff fileSize = in.tellg();
+    in.seekg(0);
+    // Counts are checked against what is left of the file before anything is
+    // sized from them, so a truncated or corrupt file can't ask for gigabytes
+    auto bytesLeft = [&]() { return static_cast<uint64_t>(fileSize - in.tellg()); };
+
+    char magic[4];
+    in.read(magic, sizeof(magic));
+    if (!in || std::memcmp(magic, fileMagic, sizeof(magic)) != 0 || readU32(in) != fileVersion)
+        return false;
+
+    seed = readU64(in);
+    tickRate = readF32(in);
+    screenWidth = static_cast<int>(readU32(in));
+    screenHeight = static_cast<int>(readU32(in));
+    initialSize = readF32(in);
+    finalChecksum = readU64(in);
+    if (!in || !std::isfinite(tickRate) || tickRate <= 0.0f)
+        return false;
+
+    uint32_t frameCount = readU32(in);
+    if (!in || frameCount > bytesLeft() / frameBytes)
+        return false;
+    frames.resize(frameCount);
+    for (InputFrame &f : frames)
+    {
+        uint8_t bits = readU8(in);
+        f.moveUp = bits & InputUp;
+        f.moveDown = bits & InputDown;
+        f.moveLeft = bits & InputLeft;
+        f.moveRight = bits & InputRight;
+        f.fire = bits & InputFire;
+        f.aimPos.x = readF32(in);
+        f.aimPos.y = readF32(in);
+    }
+
+    uint32_t commandCount = readU32(in);
+    if (!in || commandCount > bytesLeft() / commandBytes)
+        return false;
+    commands.resize(commandCount);
+    for (Command &c : commands)
+    {
+        c.tick = readU32(in);
+        c.type = static_cast<CommandType>(readU8(in));
+        c.value = static_cast<int>(readU32(in));
+    }
+
+    return static_cast<bool>(in);
+}
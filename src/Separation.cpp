@@ -0,0 +1,78 @@
+#include "../include/Separation.hpp"
+#include <cmath>
+
+namespace
+{
+    // Spreads perfectly stacked bodies in different directions
+    const float goldenAngle = 2.39996323f;
+}
+
+Separation::Separation(sf::Vector2f worldSize)
+    : grid(worldSize)
+{
+}
+
+void Separation::clear()
+{
+    grid.clear();
+    positions.clear();
+    radii.clear();
+    active.clear();
+}
+
+void Separation::add(sf::Vector2f pos, float radius, bool isActive)
+{
+    if (isActive)
+        grid.insert(static_cast<int>(positions.size()), pos, radius);
+    positions.push_back(pos);
+    radii.push_back(radius);
+    active.push_back(isActive);
+}
+
+void Separation::build()
+{
+    grid.build();
+    pushes.resize(positions.size());
+}
+
+void Separation::solve(size_t begin, size_t end)
+{
+    for (size_t i = begin; i < end; i++)
+    {
+        if (!active[i])
+        {
+            pushes[i] = sf::Vector2f(0.0f, 0.0f);
+            continue;
+        }
+
+        sf::Vector2f pos = positions[i];
+        float radius = radii[i];
+        sf::Vector2f push(0.0f, 0.0f);
+
+        grid.query(pos, radius, [&](int j)
+        {
+            if (static_cast<size_t>(j) == i)
+                return;
+
+            sf::Vector2f d = pos - positions[j];
+            float reach = radius + radii[j];
+            float dist2 = d.x * d.x + d.y * d.y;
+            if (dist2 >= reach * reach)
+                return;
+
+            // Share of the overlap this body takes, by the other's size
+            float share = radii[j] / reach;
+            if (dist2 == 0.0f)
+            {
+                float angle = static_cast<float>(i) * goldenAngle;
+                push += sf::Vector2f(std::cos(angle), std::sin(angle)) * share;
+                return;
+            }
+
+            float dist = std::sqrt(dist2);
+            push += d * ((1.0f - dist / reach) * share / dist);
+        });
+
+        pushes[i] = push;
+    }
+}
@@ -0,0 +1,580 @@
+#include "../include/Simulation.hpp"
+#include "../include/Profiler.hpp"
+#include <cmath>
+#include <algorithm>
+
+Simulation::Simulation(int sw, int sh, float tickRate, unsigned workerThreads)
+    : screenW(static_cast<float>(sw)), screenH(static_cast<float>(sh)),
+      player(15.0f, 5.0f, sw / 2.0f, sh / 2.0f),
+      bullets(maxBullets, BulletOwner::Player), enemyBullets(maxBullets, BulletOwner::Enemy),
+      bulletGrid(sf::Vector2f(screenW, screenH)),
+      enemyBulletGrid(sf::Vector2f(screenW, screenH)),
+      flowField(sf::Vector2f(screenW, screenH)),
+      separation(sf::Vector2f(screenW, screenH)),
+      simdTier(detectSimdTier()), wallMask(maxBullets), enemyWallMask(maxBullets),
+      jobs(std::make_unique<JobSystem>(workerThreads)),
+      playingWindow(std::make_unique<PlayingWindow>(sw, sh, 675.0f)),
+      tickDuration(1.0f / tickRate)
+{
+    enemies.setTickRate(tickRate);
+    buildStepGraph();
+}
+
+void Simulation::buildStepGraph()
+{
+    // Added in the old serial order, phases that share no data may overlap
+    stepGraph.addTask("Window update", 0, DataWindowBounds | DataWindowTargets | DataStats, [this]
+    {
+        gameTime += stepDt;
+        stats.timeSurvived = static_cast<int>(gameTime);
+        playingWindow->update(stepDt);
+    });
+    stepGraph.addTask("Player update", DataWindowBounds, DataPlayerMotion | DataPlayerState | DataBullets, [this]
+    {
+        updatePlayer(stepDt, *stepInput);
+    });
+    stepGraph.addTask("Player bullets", DataWindowBounds, DataBullets, [this]
+    {
+        updatePlayerBullets(stepDt);
+    });
+    stepGraph.addTask("Enemy bullets", DataWindowBounds | DataPlayerMotion, DataEnemyBullets | DataPlayerState, [this]
+    {
+        updateEnemyBullets(stepDt);
+    });
+    stepGraph.addTask("Enemy spawn", DataWindowBounds | DataStats, DataEnemies | DataSpawner, [this]
+    {
+        spawnEnemies(stepDt);
+    });
+    stepGraph.addTask("Flow field", DataPlayerMotion | DataWindowBounds | DataEnemies, DataFlowField, [this]
+    {
+        PROFILE_SCOPE("Flow field");
+        flowField.update(player.getPosition(), getWallBounds(), enemies.size());
+    });
+    stepGraph.addTask("Enemy timers", DataFlowField, DataEnemies, [this]
+    {
+        PROFILE_SCOPE("Enemy timers");
+        enemies.updateTimers(flowField);
+    });
+    stepGraph.addTask("Enemy LOD", DataEnemies | DataWindowBounds, DataEnemyLod, [this]
+    {
+        updateEnemyLod();
+    });
+    stepGraph.addTask("Enemy separation", DataEnemies | DataEnemyLod, DataSeparation, [this]
+    {
+        separateEnemies();
+    });
+    stepGraph.addTask("Enemy AI", DataFlowField | DataSeparation | DataEnemyLod, DataEnemies | DataShotBuffers, [this]
+    {
+        updateEnemyAI(stepDt);
+    });
+    stepGraph.addTask("Enemy shots", DataShotBuffers, DataEnemyBullets, [this]
+    {
+        mergeEnemyShots();
+    });
+    stepGraph.addTask("Enemy collisions", DataPlayerMotion | DataWindowBounds, DataEnemies | DataBullets | DataPlayerState | DataStats | DataWindowTargets, [this]
+    {
+        resolveEnemyCollisions();
+    });
+}
+
+void Simulation::reset(float initialSize, uint64_t runSeed)
+{
+    this->initialSize = initialSize;
+    seed = runSeed;
+    rng.reseed(seed);
+    tickCount = 0;
+    recording = nullptr;
+
+    playingWindow = std::make_unique<PlayingWindow>(static_cast<int>(screenW), static_cast<int>(screenH), initialSize);
+    playingWindow->startCollapseAnimation();
+
+    player = Player(15.0f, 5.0f, screenW / 2.0f, screenH / 2.0f);
+    bullets.clear();
+    enemyBullets.clear();
+    enemies.clear();
+    stats = GameStats();
+
+    accumulator = 0.0f;
+    gameTime = 0.0f;
+    enemySpawnTimer = 0.0f;
+}
+
+void Simulation::skipCollapseAnimation()
+{
+    while (!playingWindow->isAnimationComplete())
+        playingWindow->update(tickDuration);
+}
+
+void Simulation::execute(const Command &command)
+{
+    if (command.type == CommandType::UpgradeStat)
+    {
+        player.upgradeStat(command.value);
+    }
+    else if (command.type == CommandType::SelectTank)
+    {
+        TankList upgrades = player.currentTank.getUpgrades();
+        if (command.value < 0 || command.value >= static_cast<int>(upgrades.size()))
+            return;
+        player.setTank(upgrades[command.value]);
+    }
+
+    if (recording)
+    {
+        Command recorded = command;
+        recorded.tick = tickCount;
+        recording->commands.push_back(recorded);
+    }
+}
+
+void Simulation::startRecording(Replay &replay)
+{
+    replay.clear();
+    replay.seed = seed;
+    replay.tickRate = getTickRate();
+    replay.screenWidth = static_cast<int>(screenW);
+    replay.screenHeight = static_cast<int>(screenH);
+    replay.initialSize = initialSize;
+    // Half an hour of input up front so recording does not allocate mid-run
+    replay.frames.reserve(static_cast<size_t>(getTickRate() * 60.0f * 30.0f));
+    recording = &replay;
+}
+
+void Simulation::stopRecording()
+{
+    if (!recording)
+        return;
+    recording->finalChecksum = getChecksum();
+    recording = nullptr;
+}
+
+uint64_t Simulation::getChecksum() const
+{
+    // FNV-1a over the raw bytes, so a single differing bit changes the result
+    uint64_t hash = 14695981039346656037ULL;
+    auto mix = [&](const void *data, size_t bytes)
+    {
+        const unsigned char *p = static_cast<const unsigned char *>(data);
+        for (size_t i = 0; i < bytes; i++)
+        {
+            hash ^= p[i];
+            hash *= 1099511628211ULL;
+        }
+    };
+    auto mixVec = [&](sf::Vector2f v)
+    {
+        mix(&v.x, sizeof(float));
+        mix(&v.y, sizeof(float));
+    };
+
+    mix(&tickCount, sizeof(tickCount));
+    mixVec(player.getPosition());
+    mix(&player.currentHealth, sizeof(float));
+    mix(&player.xp, sizeof(int));
+    mix(player.statLevels, sizeof(player.statLevels));
+    mix(&stats, sizeof(stats));
+
+    float walls[4] = {playingWindow->getLeft(), playingWindow->getRight(), playingWindow->getTop(), playingWindow->getBottom()};
+    mix(walls, sizeof(walls));
+
+    for (const BulletPool *pool : {&bullets, &enemyBullets})
+    {
+        mix(pool->x.data(), pool->size() * sizeof(float));
+        mix(pool->y.data(), pool->size() * sizeof(float));
+    }
+    enemies.forEach([&](const Enemy &e) { mixVec(e.getPosition()); });
+
+    return hash;
+}
+
+void Simulation::setTickRate(float ticksPerSecond)
+{
+    tickDuration = 1.0f / ticksPerSecond;
+    accumulator = 0.0f;
+    enemies.setTickRate(ticksPerSecond);
+}
+
+int Simulation::advance(float frameTime, const InputFrame &input)
+{
+    accumulator += std::min(frameTime, maxFrameTime);
+
+    int ticks = 0;
+    while (accumulator >= tickDuration && !isPlayerDead())
+    {
+        step(tickDuration, input);
+        accumulator -= tickDuration;
+        ticks++;
+    }
+    return ticks;
+}
+
+void Simulation::savePreviousState()
+{
+    player.savePreviousState();
+    bullets.savePreviousState();
+    enemyBullets.savePreviousState();
+    enemies.forEach([](Enemy &e) { e.savePreviousState(); });
+    previousWalls = getWallBounds();
+}
+
+void Simulation::step(float dt, const InputFrame &input)
+{
+    PROFILE_SCOPE("Simulation::step");
+    if (recording)
+        recording->frames.push_back(input);
+
+    savePreviousState();
+
+    stepDt = dt;
+    stepInput = &input;
+    stepGraph.run(*jobs);
+    stepInput = nullptr;
+
+    tickCount++;
+
+    PROFILE_COUNTER("Player bullets", bullets.size());
+    PROFILE_COUNTER("Enemy bullets", enemyBullets.size());
+    PROFILE_COUNTER("Enemies", enemies.size());
+    PROFILE_COUNTER("Far enemies", farEnemies);
+}
+
+bool Simulation::isPlayerDead() const
+{
+    return player.isDead();
+}
+
+void Simulation::updatePlayer(float dt, const InputFrame &input)
+{
+    PROFILE_SCOPE("Player update");
+    // Player orientation
+    sf::Vector2f playerPos = player.getPosition();
+    sf::Vector2f dir = input.aimPos - playerPos;
+    float angle = std::atan2(dir.y, dir.x) * 180.0f / 3.14159f;
+    player.setRotation(angle);
+
+    player.handleInput(input);
+    player.update(dt);
+    player.constrainToWindow(*playingWindow);
+
+    // Player shooting
+    if (input.fire && player.reloadTimer <= 0.0f)
+    {
+        player.createBullets(input.aimPos, bullets);
+        player.reloadTimer = player.currentReload;
+    }
+}
+
+WallBounds Simulation::getWallBounds() const
+{
+    return {playingWindow->getLeft(), playingWindow->getRight(), playingWindow->getTop(), playingWindow->getBottom()};
+}
+
+void Simulation::updatePlayerBullets(float dt)
+{
+    PROFILE_SCOPE("Player bullets");
+    WallBounds walls = getWallBounds();
+    integrateBullets(simdTier, bullets, dt, walls, wallMask.data());
+
+    // Find the moment each escaping bullet crossed its wall, the wall is
+    // pushed once enemy collisions know the bullet got that far
+    bulletWallHits.resize(bullets.size());
+    for (size_t i = 0; i < bullets.size(); i++)
+    {
+        bulletWallHits[i] = wallMask[i] ? Collision::sweptWalls(bullets.getPreviousPosition(i), bullets.getPosition(i), wallMask[i], previousWalls, walls)
+                                        : Collision::WallHit();
+    }
+}
+
+void Simulation::updateEnemyBullets(float dt)
+{
+    PROFILE_SCOPE("Enemy bullets");
+    WallBounds walls = getWallBounds();
+    integrateBullets(simdTier, enemyBullets, dt, walls, enemyWallMask.data());
+
+    // Each bullet goes in with a circle around its whole path this tick
+    enemyBulletGrid.clear();
+    for (size_t i = 0; i < enemyBullets.size(); i++)
+    {
+        sf::Vector2f centre;
+        float reach = Collision::sweptRadius(enemyBullets.getPreviousPosition(i), enemyBullets.getPosition(i), enemyBullets.radius[i], centre);
+        enemyBulletGrid.insert(static_cast<int>(i), centre, reach);
+    }
+    enemyBulletGrid.build();
+
+    // Player collision, swept so low tick rates cannot skip a hit
+    enemyBulletSpent.assign(enemyBullets.size(), 0);
+    sf::Vector2f p0 = player.getPreviousPosition();
+    sf::Vector2f p1 = player.getPosition();
+    sf::Vector2f pCentre;
+    float pReach = Collision::sweptRadius(p0, p1, player.getRadius(), pCentre);
+    enemyBulletGrid.query(pCentre, pReach, [&](int id)
+    {
+        float t = Collision::sweptCircles(enemyBullets.getPreviousPosition(id), enemyBullets.getPosition(id), enemyBullets.radius[id], p0, p1, player.getRadius());
+        if (t == Collision::noHit)
+            return;
+
+        // A bullet that left through a wall first never reaches the player
+        if (enemyWallMask[id] && Collision::sweptWalls(enemyBullets.getPreviousPosition(id), enemyBullets.getPosition(id), enemyWallMask[id], previousWalls, walls).time < t)
+            return;
+
+        player.takeDamage(enemyBullets.damage[id]);
+        enemyBulletSpent[id] = 1;
+    });
+
+    // Drop bullets that hit the player or left through a wall
+    for (size_t i = enemyBullets.size(); i-- > 0;)
+        if (enemyBulletSpent[i] || enemyWallMask[i])
+            enemyBullets.remove(i);
+}
+
+void Simulation::spawnEnemies(float dt)
+{
+    PROFILE_SCOPE("Enemy spawn");
+    enemySpawnTimer += dt;
+    if (enemySpawnTimer <= enemySpawnInterval)
+        return;
+
+    // Calculate spawn position outside window
+    float buffer = 50.0f;
+    float x, y;
+    int side = rng.nextInt(4);
+
+    if (side == 0) // Top
+    {
+        x = playingWindow->getLeft() + static_cast<float>(rng.nextInt(static_cast<int>(playingWindow->getWidth())));
+        y = playingWindow->getTop() - buffer;
+    }
+    else if (side == 1) // Bottom
+    {
+        x = playingWindow->getLeft() + static_cast<float>(rng.nextInt(static_cast<int>(playingWindow->getWidth())));
+        y = playingWindow->getBottom() + buffer;
+    }
+    else if (side == 2) // Left
+    {
+        x = playingWindow->getLeft() - buffer;
+        y = playingWindow->getTop() + static_cast<float>(rng.nextInt(static_cast<int>(playingWindow->getHeight())));
+    }
+    else // Right
+    {
+        x = playingWindow->getRight() + buffer;
+        y = playingWindow->getTop() + static_cast<float>(rng.nextInt(static_cast<int>(playingWindow->getHeight())));
+    }
+
+    sf::Vector2f spawnPos(x, y);
+    int roll = rng.nextInt(100);
+    int time = stats.timeSurvived;
+
+    // Check if boss active
+    bool bossExists = enemies.count<Spiker>() > 0;
+
+    // Spawn logic
+    if (time > 60 && !bossExists && (rng.nextInt(20) == 0))
+    {
+        enemies.spawn<Spiker>(spawnPos);
+    }
+    else
+    {
+        if (roll < 50) enemies.spawn<Triangle>(spawnPos);
+        else if (roll < 75) enemies.spawn<Circle>(spawnPos);
+        else enemies.spawn<Square>(spawnPos);
+    }
+
+    enemySpawnTimer = 0.0f;
+}
+
+bool Simulation::isFarFromWindow(sf::Vector2f pos, const WallBounds &walls)
+{
+    return pos.x < walls.left - lodMargin || pos.x > walls.right + lodMargin ||
+           pos.y < walls.top - lodMargin || pos.y > walls.bottom + lodMargin;
+}
+
+void Simulation::updateEnemyLod()
+{
+    PROFILE_SCOPE("Enemy LOD");
+    WallBounds walls = getWallBounds();
+    enemyLod.clear();
+    farEnemies = 0;
+    enemies.forEachGroup([&](const auto &group)
+    {
+        for (size_t i = 0; i < group.size(); i++)
+        {
+            if (!enemyLodEnabled || !isFarFromWindow(group[i].getPosition(), walls))
+            {
+                enemyLod.push_back(LodFull);
+                continue;
+            }
+
+            // Staggered by slot so the coarse steps spread over the interval
+            farEnemies++;
+            bool due = (tickCount + group.getHandle(i).slot) % lodInterval == 0;
+            enemyLod.push_back(due ? LodCoarse : LodSkip);
+        }
+    });
+}
+
+void Simulation::separateEnemies()
+{
+    PROFILE_SCOPE("Enemy separation");
+    separation.clear();
+    size_t index = 0;
+    enemies.forEachGroup([&](const auto &group)
+    {
+        for (const auto &enemy : group)
+            separation.add(enemy.getPosition(), enemy.getRadius(), enemyLod[index++] == LodFull);
+    });
+    separation.build();
+
+    // Every push only reads the positions gathered above
+    jobs->parallelFor(separation.size(), enemiesPerChunk, [&](size_t, size_t begin, size_t end)
+    {
+        PROFILE_SCOPE("Enemy separation chunk");
+        separation.solve(begin, end);
+    });
+}
+
+template <typename T>
+void Simulation::updateEnemyGroupAI(EnemyPool<T> &group, const sf::Vector2f *pushes, const EnemyLod *lods, float dt)
+{
+    // AI only reads the enemy itself, the flow field and its own push, so
+    // chunks can run on any thread
+    size_t firstBuffer = shotBuffersUsed;
+    size_t chunks = (group.size() + enemiesPerChunk - 1) / enemiesPerChunk;
+    shotBuffersUsed += chunks;
+    if (shotBuffers.size() < shotBuffersUsed)
+        shotBuffers.resize(shotBuffersUsed);
+
+    jobs->parallelFor(group.size(), enemiesPerChunk, [&](size_t chunk, size_t begin, size_t end)
+    {
+        PROFILE_SCOPE("Enemy AI chunk");
+        ShotBuffer &shots = shotBuffers[firstBuffer + chunk];
+        for (size_t i = begin; i < end; i++)
+        {
+            if (lods[i] == LodFull)
+                group[i].update(flowField, pushes[i], dt, shots);
+            else if (lods[i] == LodCoarse)
+                group[i].update(flowField, pushes[i], dt * lodInterval, shots);
+        }
+    });
+}
+
+void Simulation::updateEnemyAI(float dt)
+{
+    PROFILE_SCOPE("Enemy AI");
+    shotBuffersUsed = 0;
+    const sf::Vector2f *pushes = separation.getPushes();
+    const EnemyLod *lods = enemyLod.data();
+    enemies.forEachGroup([&](auto &group)
+    {
+        updateEnemyGroupAI(group, pushes, lods, dt);
+        pushes += group.size();
+        lods += group.size();
+    });
+}
+
+void Simulation::mergeEnemyShots()
+{
+    // Same firing order as one thread walking every group, whatever the thread count
+    for (size_t i = 0; i < shotBuffersUsed; i++)
+        shotBuffers[i].flushInto(enemyBullets);
+}
+
+template <typename T>
+void Simulation::resolveEnemyGroup(EnemyPool<T> &group)
+{
+    for (size_t i = 0; i < group.size();)
+    {
+        T &enemy = group[i];
+
+        // Player collision
+        sf::Vector2f ePos = enemy.getPosition();
+        sf::Vector2f pPos = player.getPosition();
+        float dist = std::sqrt(std::pow(ePos.x - pPos.x, 2) + std::pow(ePos.y - pPos.y, 2));
+        if (dist < player.getRadius() + enemy.getRadius())
+        {
+            player.takeDamage(T::contactDamage);
+
+            // Apply body damage to enemy
+            enemy.takeDamage(static_cast<int>(player.currentBodyDamage));
+        }
+
+        // Bullet collision, the first bullet to touch the enemy during the
+        // tick is consumed, the one at the lowest pool index on a tie. That is
+        // not the oldest, removal swaps the last bullet into the freed slot.
+        // Bullets stop at the wall they leave through, so enemies past the
+        // LOD margin are never tested.
+        int hitIndex = -1;
+        float hitTime = Collision::noHit;
+        float eRadius = enemy.getRadius();
+        sf::Vector2f e0 = enemy.getPreviousPosition();
+        sf::Vector2f eCentre;
+        float eReach = Collision::sweptRadius(e0, ePos, eRadius, eCentre);
+        if (!enemyLodEnabled || !isFarFromWindow(e0, previousWalls))
+        {
+            bulletGrid.query(eCentre, eReach, [&](int id)
+            {
+                if (bulletSpent[id])
+                    return;
+
+                float t = Collision::sweptCircles(bullets.getPreviousPosition(id), bullets.getPosition(id), bullets.radius[id], e0, ePos, eRadius);
+                if (t == Collision::noHit || t > bulletWallHits[id].time)
+                    return;
+                if (t < hitTime || (t == hitTime && id < hitIndex))
+                {
+                    hitTime = t;
+                    hitIndex = id;
+                }
+            });
+        }
+
+        if (hitIndex != -1)
+        {
+            enemy.takeDamage(bullets.damage[hitIndex]);
+            bulletSpent[hitIndex] = 1;
+        }
+
+        // Removal swaps another enemy into slot i, so only advance when kept
+        if (enemy.isDead())
+        {
+            player.earnXp(enemy.getCurrencyDrop() * 10);
+            stats.enemiesKilled++;
+            enemies.remove<T>(i);
+        }
+        else
+        {
+            ++i;
+        }
+    }
+}
+
+void Simulation::resolveEnemyCollisions()
+{
+    PROFILE_SCOPE("Enemy collisions");
+    bulletGrid.clear();
+    for (size_t i = 0; i < bullets.size(); i++)
+    {
+        sf::Vector2f centre;
+        float reach = Collision::sweptRadius(bullets.getPreviousPosition(i), bullets.getPosition(i), bullets.radius[i], centre);
+        bulletGrid.insert(static_cast<int>(i), centre, reach);
+    }
+    bulletGrid.build();
+    bulletSpent.assign(bullets.size(), 0);
+
+    // Collisions touch the player and the shared bullets, so they stay serial
+    enemies.forEachGroup([&](auto &group) { resolveEnemyGroup(group); });
+
+    // Remove consumed bullets once the grid is no longer referenced. Bullets
+    // that got past a wall push it outwards; walking backwards means the
+    // bullet swapped into a freed slot has already been handled.
+    for (size_t i = bullets.size(); i-- > 0;)
+    {
+        if (bulletSpent[i])
+        {
+            bullets.remove(i);
+        }
+        else if (wallMask[i])
+        {
+            playingWindow->hitWall(bulletWallHits[i].wall);
+            bullets.remove(i);
+        }
+    }
+}
@@ -0,0 +1,50 @@
+#include "../include/SpatialGrid.hpp"
+#include <cmath>
+
+SpatialGrid::SpatialGrid(sf::Vector2f worldSize, float cellSize)
+    : cellSize(cellSize), invCellSize(1.0f / cellSize)
+{
+    columns = std::max(1, static_cast<int>(std::ceil(worldSize.x * invCellSize)));
+    rows = std::max(1, static_cast<int>(std::ceil(worldSize.y * invCellSize)));
+    cellStart.assign(columns * rows + 1, 0);
+}
+
+int SpatialGrid::cellX(float x) const
+{
+    return std::clamp(static_cast<int>(std::floor(x * invCellSize)), 0, columns - 1);
+}
+
+int SpatialGrid::cellY(float y) const
+{
+    return std::clamp(static_cast<int>(std::floor(y * invCellSize)), 0, rows - 1);
+}
+
+void SpatialGrid::clear()
+{
+    itemIds.clear();
+    itemCells.clear();
+    maxRadius = 0.0f;
+}
+
+void SpatialGrid::insert(int id, sf::Vector2f pos, float radius)
+{
+    itemIds.push_back(id);
+    itemCells.push_back(cellY(pos.y) * columns + cellX(pos.x));
+    maxRadius = std::max(maxRadius, radius);
+}
+
+void SpatialGrid::build()
+{
+    // Counting sort by cell keeps each cell's items contiguous and in insertion order
+    std::fill(cellStart.begin(), cellStart.end(), 0);
+    for (int cell : itemCells)
+        cellStart[cell + 1]++;
+
+    for (size_t c = 1; c < cellStart.size(); c++)
+        cellStart[c] += cellStart[c - 1];
+
+    cellCursor.assign(cellStart.begin(), cellStart.end() - 1);
+    cellItems.resize(itemIds.size());
+    for (size_t i = 0; i < itemIds.size(); i++)
+        cellItems[cellCursor[itemCells[i]]++] = itemIds[i];
+}
@@ -0,0 +1,152 @@
+#include "../include/TaskGraph.hpp"
+#include "../include/Profiler.hpp"
+#include <algorithm>
+#include <thread>
+
+namespace
+{
+// Set while this thread runs a lane, see runLane()
+thread_local bool insideLane = false;
+}
+
+int TaskGraph::addTask(const char *name, uint32_t reads, uint32_t writes, std::function<void()> fn)
+{
+    int index = static_cast<int>(tasks.size());
+    Task task{name, reads, writes, std::move(fn), {}, {}};
+
+    for (int i = 0; i < index; i++)
+    {
+        const Task &earlier = tasks[i];
+        bool conflict = (earlier.writes & (reads | writes)) || (earlier.reads & writes);
+        if (conflict)
+        {
+            task.dependencies.push_back(i);
+            tasks[i].dependents.push_back(index);
+        }
+    }
+
+    int level = 0;
+    for (int d : task.dependencies)
+        level = std::max(level, levels[d] + 1);
+    levels.push_back(level);
+    width = std::max<size_t>(width, std::count(levels.begin(), levels.end(), level));
+
+    tasks.push_back(std::move(task));
+
+    waitingOn = std::make_unique<std::atomic<int>[]>(tasks.size());
+    ready.reserve(tasks.size());
+    return index;
+}
+
+int TaskGraph::takeReadyTask()
+{
+    std::lock_guard<std::mutex> lock(readyMutex);
+    if (ready.empty())
+        return -1;
+
+    // Lowest index first, the order a single thread would use
+    auto next = std::min_element(ready.begin(), ready.end());
+    int task = *next;
+    ready.erase(next);
+    return task;
+}
+
+void TaskGraph::runLane(JobSystem &jobs)
+{
+    // A thread waiting inside a task helps the job system and may pick up
+    // another lane. That lane would wait for the very task below it on the
+    // stack, so it is skipped, the outer lane carries on after the task.
+    if (insideLane)
+        return;
+    insideLane = true;
+
+    while (finished.load(std::memory_order_acquire) < tasks.size())
+    {
+        int index = takeReadyTask();
+        if (index < 0)
+        {
+            // Help with loops the running tasks handed to the job system
+            if (!jobs.runPendingJob())
+                std::this_thread::yield();
+            continue;
+        }
+
+        Task &task = tasks[index];
+        task.start = Profiler::now();
+        task.fn();
+        task.end = Profiler::now();
+
+        for (int dependent : task.dependents)
+        {
+            if (waitingOn[dependent].fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                std::lock_guard<std::mutex> lock(readyMutex);
+                ready.push_back(dependent);
+            }
+        }
+        finished.fetch_add(1, std::memory_order_release);
+    }
+    insideLane = false;
+}
+
+void TaskGraph::run(JobSystem &jobs)
+{
+    finished.store(0, std::memory_order_relaxed);
+    ready.clear();
+    for (size_t i = 0; i < tasks.size(); i++)
+    {
+        waitingOn[i].store(static_cast<int>(tasks[i].dependencies.size()), std::memory_order_relaxed);
+        if (tasks[i].dependencies.empty())
+            ready.push_back(static_cast<int>(i));
+    }
+
+    // Each lane keeps picking up ready tasks until the whole graph is done.
+    // Tasks may use the job system themselves, waiting lanes do not block that.
+    size_t lanes = std::min(width, jobs.getWorkerCount() + 1);
+    jobs.parallelFor(lanes, 1, [&](size_t, size_t, size_t) { runLane(jobs); });
+}
+
+TaskGraph::CriticalPath TaskGraph::findCriticalPath(const std::vector<double> &cost) const
+{
+    CriticalPath result;
+    size_t count = tasks.size();
+    result.earliestFinish.assign(count, 0.0);
+    result.slack.assign(count, 0.0);
+    if (count == 0)
+        return result;
+
+    // Dependencies always point at earlier tasks, so index order is topological
+    std::vector<int> slowestDependency(count, -1);
+    int last = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        double start = 0.0;
+        for (int d : tasks[i].dependencies)
+        {
+            if (result.earliestFinish[d] > start)
+            {
+                start = result.earliestFinish[d];
+                slowestDependency[i] = d;
+            }
+        }
+        result.earliestFinish[i] = start + cost[i];
+        result.serialLength += cost[i];
+        if (result.earliestFinish[i] > result.earliestFinish[last])
+            last = static_cast<int>(i);
+    }
+    result.length = result.earliestFinish[last];
+
+    // Latest finish that does not delay the frame, walking backwards
+    std::vector<double> latestFinish(count, result.length);
+    for (size_t i = count; i-- > 0;)
+    {
+        for (int d : tasks[i].dependents)
+            latestFinish[i] = std::min(latestFinish[i], latestFinish[d] - cost[d]);
+        result.slack[i] = latestFinish[i] - result.earliestFinish[i];
+    }
+
+    for (int t = last; t != -1; t = slowestDependency[t])
+        result.tasks.push_back(t);
+    std::reverse(result.tasks.begin(), result.tasks.end());
+    return result;
+}
@@ -1,6 +1,76 @@
 #include "../include/UIRenderer.hpp"
 #include <iostream>
 
+namespace
+{
+struct StatBarStyle
+{
+    const char *label;
+    sf::Color color;
+};
+
+// Indexed like Player::statLevels
+const StatBarStyle statBars[8] = {
+    {"Health Regen", sf::Color(255, 150, 100)},
+    {"Max Health", sf::Color(255, 100, 255)},
+    {"Body Damage", sf::Color(150, 100, 255)},
+    {"Bullet Speed", sf::Color(100, 150, 255)},
+    {"Bullet Pen.", sf::Color(255, 255, 100)},
+    {"Bullet Damage", sf::Color(255, 100, 100)},
+    {"Reload", sf::Color(100, 255, 100)},
+    {"Movement Spd", sf::Color(100, 255, 255)},
+};
+
+// Stat bar layout relative to the upgrade window
+const float statBarX = 50.0f;
+const float statBarY = 100.0f;
+const float statBarGap = 35.0f;
+const float statBarWidth = 250.0f;
+const float statBarHeight = 20.0f;
+
+// Class selection grid relative to the upgrade window
+const float classGridX = 100.0f;
+const float classGridY = 150.0f;
+const float classBoxSize = 120.0f;
+const float classBoxGap = 30.0f;
+}
+
+UIRenderer::UIRenderer(const sf::Font &font, sf::Vector2f upgradeWindowSize)
+    : font(font),
+      titleText(font, "WindowShock", 50, sf::Color::White),
+      startText(font, "Press SPACE to Start", 20, sf::Color(200, 200, 200)),
+      gameOverText(font, "GAME OVER", 50, sf::Color::Red),
+      killsText(font, "", 20, sf::Color::White),
+      timeText(font, "", 20, sf::Color::White),
+      restartText(font, "Press SPACE to Restart", 18, sf::Color(150, 150, 150)),
+      levelText(font, "", 16, sf::Color::White),
+      tankUpgradeHint(font, "Tank Upgrade Available!", 18, sf::Color::Cyan, false),
+      pointsText(font, "", 24, sf::Color::White, false),
+      tankUpgradeText(font, "Tank Upgrade ->", 18, sf::Color::White),
+      plusGlyph(font, "+", 16, sf::Color::Black)
+{
+    xpBackground.setFillColor(sf::Color(50, 50, 50));
+    xpFill.setFillColor(sf::Color(255, 215, 0));
+
+    statButton.setSize(sf::Vector2f(statBarHeight, statBarHeight));
+    tankUpgradeButton.setSize(sf::Vector2f(200.0f, 40.0f));
+    tankUpgradeButton.setFillColor(sf::Color(0, 100, 200));
+
+    classBox.setSize(sf::Vector2f(classBoxSize, classBoxSize));
+    classBox.setFillColor(sf::Color(0, 178, 225));
+    classBox.setOutlineColor(sf::Color::White);
+    classBox.setOutlineThickness(2);
+
+    classNames.reserve(TankTable::maxUpgrades);
+    for (size_t i = 0; i < TankTable::maxUpgrades; i++)
+        classNames.emplace_back(font, "", 14, sf::Color::White);
+
+    previewQuads.reserve(TankTable::maxUpgrades * 6);
+
+    bakeChrome(upgradeWindowSize);
+    bakePreviews();
+}
+
 void UIRenderer::centerText(sf::Text &text, float x, float y)
 {
     sf::FloatRect bounds = text.getLocalBounds();
@@ -8,228 +78,305 @@ void UIRenderer::centerText(sf::Text &text, float x, float y)
     text.setPosition(sf::Vector2f(x, y));
 }
 
-void UIRenderer::drawWelcomeScreen(sf::RenderWindow &window, const sf::Font &font, const FakeWindow &fw)
+void UIRenderer::drawWelcomeScreen(sf::RenderWindow &window, const FakeWindow &fw)
 {
     sf::Vector2f pos = fw.getPosition();
     sf::Vector2f size = fw.getSize();
     float centerX = pos.x + size.x / 2.0f;
     float centerY = pos.y + size.y / 2.0f;
 
-    sf::Text title(font, "WindowShock", 50);
-    title.setFillColor(sf::Color::White);
-    centerText(title, centerX, centerY - 50);
-    window.draw(title);
+    titleText.setPosition(sf::Vector2f(centerX, centerY - 50));
+    titleText.draw(window);
 
-    sf::Text sub(font, "Press SPACE to Start", 20);
-    sub.setFillColor(sf::Color(200, 200, 200));
-    centerText(sub, centerX, centerY + 20);
-    window.draw(sub);
+    startText.setPosition(sf::Vector2f(centerX, centerY + 20));
+    startText.draw(window);
 }
 
-void UIRenderer::drawGameOverScreen(sf::RenderWindow &window, const sf::Font &font, const GameStats &stats, const FakeWindow &fw)
+void UIRenderer::drawGameOverScreen(sf::RenderWindow &window, const GameStats &stats, const FakeWindow &fw)
 {
     sf::Vector2f pos = fw.getPosition();
     sf::Vector2f size = fw.getSize();
     float centerX = pos.x + size.x / 2.0f;
     float centerY = pos.y + size.y / 2.0f;
 
-    sf::Text title(font, "GAME OVER", 50);
-    title.setFillColor(sf::Color::Red);
-    centerText(title, centerX, centerY - 60);
-    window.draw(title);
+    gameOverText.setPosition(sf::Vector2f(centerX, centerY - 60));
+    gameOverText.draw(window);
+
+    killsText.setNumber("Enemies Killed: ", stats.enemiesKilled);
+    killsText.setPosition(sf::Vector2f(centerX, centerY));
+    killsText.draw(window);
 
-    sf::Text score(font, "Enemies Killed: " + std::to_string(stats.enemiesKilled), 20);
-    score.setFillColor(sf::Color::White);
-    centerText(score, centerX, centerY);
-    window.draw(score);
+    timeText.setNumber("Time Survived: ", stats.timeSurvived, "s");
+    timeText.setPosition(sf::Vector2f(centerX, centerY + 30));
+    timeText.draw(window);
 
-    sf::Text time(font, "Time Survived: " + std::to_string(stats.timeSurvived) + "s", 20);
-    time.setFillColor(sf::Color::White);
-    centerText(time, centerX, centerY + 30);
-    window.draw(time);
-    
-    sf::Text restart(font, "Press SPACE to Restart", 18);
-    restart.setFillColor(sf::Color(150, 150, 150));
-    centerText(restart, centerX, centerY + 80);
-    window.draw(restart);
+    restartText.setPosition(sf::Vector2f(centerX, centerY + 80));
+    restartText.draw(window);
 }
 
-void UIRenderer::drawHUD(sf::RenderWindow &window, const sf::Font &font, const Player &player, const FakeWindow &fw)
+void UIRenderer::drawHUD(sf::RenderWindow &window, const Player &player, const FakeWindow &fw)
 {
     sf::Vector2f winPos = fw.getPosition();
     sf::Vector2f winSize = fw.getSize();
-    
+
     // Draw XP Bar
     float barWidth = winSize.x * 0.6f;
     float barHeight = 10.0f;
     float barX = winPos.x + (winSize.x - barWidth) / 2.0f;
     float barY = winPos.y + winSize.y - 30.0f;
-    
-    sf::RectangleShape xpBg(sf::Vector2f(barWidth, barHeight));
-    xpBg.setPosition(sf::Vector2f(barX, barY));
-    xpBg.setFillColor(sf::Color(50, 50, 50));
-    window.draw(xpBg);
-    
+
+    xpBackground.setSize(sf::Vector2f(barWidth, barHeight));
+    xpBackground.setPosition(sf::Vector2f(barX, barY));
+    window.draw(xpBackground);
+
     float xpRatio = 0.0f;
     int req = player.getXpForNextLevel();
     if (req > 0) xpRatio = (float)player.xp / req;
     if (xpRatio > 1.0f) xpRatio = 1.0f;
-    
-    sf::RectangleShape xpFill(sf::Vector2f(barWidth * xpRatio, barHeight));
+
+    xpFill.setSize(sf::Vector2f(barWidth * xpRatio, barHeight));
     xpFill.setPosition(sf::Vector2f(barX, barY));
-    xpFill.setFillColor(sf::Color(255, 215, 0));
     window.draw(xpFill);
-    
-    sf::Text lvlText(font, "Lvl " + std::to_string(player.level), 16);
-    lvlText.setFillColor(sf::Color::White);
-    centerText(lvlText, barX + barWidth / 2.0f, barY - 15.0f);
-    window.draw(lvlText);
-    
+
+    // Only re-laid out on level up
+    levelText.setNumber("Lvl ", player.level);
+    levelText.setPosition(sf::Vector2f(barX + barWidth / 2.0f, barY - 15.0f));
+    levelText.draw(window);
+
     // Display tank upgrade availability
-    if (player.level >= 10 && player.currentTank->getUpgrades().size() > 0)
+    if (player.level >= 10 && !player.currentTank.getUpgrades().empty())
+    {
+        tankUpgradeHint.setPosition(sf::Vector2f(winPos.x + winSize.x - 220, winPos.y + 40));
+        tankUpgradeHint.draw(window);
+    }
+}
+
+void UIRenderer::bakeChrome(sf::Vector2f size)
+{
+    sf::Vector2u texSize(static_cast<unsigned int>(size.x), static_cast<unsigned int>(size.y));
+    if (!statsBackground.resize(texSize) || !statsLabels.resize(texSize) || !classChrome.resize(texSize))
+        return;
+
+    statsBackground.clear(sf::Color::Transparent);
+    drawStatsBackground(statsBackground, sf::Vector2f(0.0f, 0.0f));
+    statsBackground.display();
+
+    statsLabels.clear(sf::Color::Transparent);
+    drawStatsLabels(statsLabels, sf::Vector2f(0.0f, 0.0f));
+    statsLabels.display();
+
+    classChrome.clear(sf::Color::Transparent);
+    drawClassChrome(classChrome, sf::Vector2f(0.0f, 0.0f), size);
+    classChrome.display();
+
+    chromeCached = true;
+}
+
+sf::Vector2f UIRenderer::getAtlasCell(Tank tank) const
+{
+    int index = static_cast<int>(tank.getId());
+    return sf::Vector2f((index % atlasColumns) * classBoxSize, (index / atlasColumns) * classBoxSize);
+}
+
+void UIRenderer::bakePreviews()
+{
+    int count = static_cast<int>(TankId::Count);
+    int rows = (count + atlasColumns - 1) / atlasColumns;
+    sf::Vector2u texSize(static_cast<unsigned int>(atlasColumns * classBoxSize), static_cast<unsigned int>(rows * classBoxSize));
+    if (!previewAtlas.resize(texSize))
+        return;
+
+    previewAtlas.clear(sf::Color::Transparent);
+    BatchRenderer batch;
+    for (int i = 0; i < count; i++)
+    {
+        Tank tank = static_cast<TankId>(i);
+        sf::Vector2f cell = getAtlasCell(tank);
+
+        Player model(15.0f, 0.0f, cell.x + classBoxSize/2, cell.y + classBoxSize/2);
+        tank.configure(model);
+        model.draw(batch);
+    }
+    batch.flush(previewAtlas);
+    previewAtlas.display();
+
+    previewsCached = true;
+}
+
+void UIRenderer::addPreview(Tank tank, sf::Vector2f pos)
+{
+    if (!previewsCached)
+    {
+        Player model(15.0f, 0.0f, pos.x + classBoxSize/2, pos.y + classBoxSize/2);
+        tank.configure(model);
+        model.draw(previewFallback);
+        return;
+    }
+
+    sf::Vector2f cell = getAtlasCell(tank);
+    sf::Vector2f corners[4] = {{0.0f, 0.0f}, {classBoxSize, 0.0f}, {classBoxSize, classBoxSize}, {0.0f, classBoxSize}};
+    const int order[6] = {0, 1, 2, 0, 2, 3};
+    for (int corner : order)
     {
-        sf::Text upgText(font, "Tank Upgrade Available!", 18);
-        upgText.setFillColor(sf::Color::Cyan);
-        upgText.setPosition(sf::Vector2f(winPos.x + winSize.x - 220, winPos.y + 40));
-        window.draw(upgText);
+        sf::Vertex v;
+        v.position = pos + corners[corner];
+        v.texCoords = cell + corners[corner];
+        previewQuads.push_back(v);
     }
 }
 
-void UIRenderer::drawStatBar(sf::RenderWindow &window, const sf::Font &font, sf::Vector2f pos, std::string label, int level, sf::Color color, bool canUpgrade, sf::Vector2i mousePos, int statIndex, Player &player)
+void UIRenderer::drawChrome(sf::RenderWindow &window, const sf::RenderTexture &layer, sf::Vector2f pos) const
+{
+    sf::Sprite sprite(layer.getTexture());
+    sprite.setPosition(pos);
+    window.draw(sprite);
+}
+
+void UIRenderer::drawStatsBackground(sf::RenderTarget &target, sf::Vector2f origin) const
 {
-    // Draw background
-    sf::RectangleShape bg(sf::Vector2f(250.0f, 20.0f));
-    bg.setPosition(pos);
+    sf::RectangleShape bg(sf::Vector2f(statBarWidth, statBarHeight));
     bg.setFillColor(sf::Color(30, 30, 30));
     bg.setOutlineColor(sf::Color(60, 60, 60));
     bg.setOutlineThickness(1.0f);
-    window.draw(bg);
-    
-    // Draw fill level
-    float fillWidth = (250.0f / 7.0f) * level;
-    sf::RectangleShape fill(sf::Vector2f(fillWidth, 20.0f));
-    fill.setPosition(pos);
-    fill.setFillColor(color);
-    window.draw(fill);
-    
-    // Draw label
-    sf::Text lbl(font, label, 14);
+
+    for (int i = 0; i < 8; i++)
+    {
+        bg.setPosition(sf::Vector2f(origin.x + statBarX, origin.y + statBarY + statBarGap * i));
+        target.draw(bg);
+    }
+}
+
+void UIRenderer::drawStatsLabels(sf::RenderTarget &target, sf::Vector2f origin) const
+{
+    sf::Text lbl(font, "", 14);
     lbl.setFillColor(sf::Color::White);
-    lbl.setPosition(sf::Vector2f(pos.x + 10, pos.y + 2));
-    window.draw(lbl);
-    
+
+    for (int i = 0; i < 8; i++)
+    {
+        lbl.setString(statBars[i].label);
+        lbl.setPosition(sf::Vector2f(origin.x + statBarX + 10, origin.y + statBarY + statBarGap * i + 2));
+        target.draw(lbl);
+    }
+}
+
+void UIRenderer::drawClassChrome(sf::RenderTarget &target, sf::Vector2f origin, sf::Vector2f size) const
+{
+    sf::Text title(font, "Select Class", 30);
+    title.setFillColor(sf::Color::White);
+    centerText(title, origin.x + size.x/2, origin.y + 50);
+    target.draw(title);
+
+    // Back Button
+    sf::RectangleShape backBtn(sf::Vector2f(100.0f, 30.0f));
+    backBtn.setPosition(sf::Vector2f(origin.x + 20, origin.y + 20));
+    backBtn.setFillColor(sf::Color(100, 100, 100));
+    target.draw(backBtn);
+
+    sf::Text backTxt(font, "<- Back", 16);
+    backTxt.setFillColor(sf::Color::White);
+    centerText(backTxt, origin.x + 70, origin.y + 35);
+    target.draw(backTxt);
+}
+
+void UIRenderer::drawStatBar(sf::RenderWindow &window, sf::Vector2f pos, int level, sf::Color color, bool canUpgrade, sf::Vector2i mousePos)
+{
+    // Draw fill level
+    float fillWidth = (statBarWidth / 7.0f) * level;
+    statFill.setSize(sf::Vector2f(fillWidth, statBarHeight));
+    statFill.setPosition(pos);
+    statFill.setFillColor(color);
+    window.draw(statFill);
+
     // Draw upgrade button
     if (canUpgrade && level < 7)
     {
-        sf::RectangleShape btn(sf::Vector2f(20.0f, 20.0f));
-        btn.setPosition(sf::Vector2f(pos.x + 260.0f, pos.y));
-        btn.setFillColor(color);
-        
+        statButton.setPosition(sf::Vector2f(pos.x + 260.0f, pos.y));
+        statButton.setFillColor(color);
+
         // Handle hover effect
-        sf::FloatRect btnRect(sf::Vector2f(pos.x + 260.0f, pos.y), sf::Vector2f(20.0f, 20.0f));
-        if (btnRect.contains(sf::Vector2f((float)mousePos.x, (float)mousePos.y)))
-        {
-            btn.setOutlineColor(sf::Color::White);
-            btn.setOutlineThickness(2.0f);
-            
-            // Interaction logic is handled in valid event loop, visual only here
-        }
-        
-        window.draw(btn);
-        
-        sf::Text plus(font, "+", 16);
-        plus.setFillColor(sf::Color::Black);
-        centerText(plus, pos.x + 270.0f, pos.y + 10.0f);
-        window.draw(plus);
+        sf::FloatRect btnRect(sf::Vector2f(pos.x + 260.0f, pos.y), sf::Vector2f(statBarHeight, statBarHeight));
+        bool hovered = btnRect.contains(sf::Vector2f((float)mousePos.x, (float)mousePos.y));
+        // Interaction logic is handled in valid event loop, visual only here
+        statButton.setOutlineColor(sf::Color::White);
+        statButton.setOutlineThickness(hovered ? 2.0f : 0.0f);
+
+        window.draw(statButton);
+
+        plusGlyph.setPosition(sf::Vector2f(pos.x + 270.0f, pos.y + 10.0f));
+        plusGlyph.draw(window);
     }
 }
 
-void UIRenderer::drawUpgradeWindow(sf::RenderWindow &window, const sf::Font &font, Player &player, sf::Vector2i mousePos, UpgradeWindow &uw)
+void UIRenderer::drawUpgradeWindow(sf::RenderWindow &window, const Player &player, sf::Vector2i mousePos, const UpgradeWindow &uw)
 {
     sf::Vector2f pos = uw.getPosition();
     sf::Vector2f size = uw.getSize();
-    
+
     if (uw.getState() == UpgradeWindowState::Stats)
     {
-        sf::Text title(font, "Stats Upgrade (Points: " + std::to_string(player.skillPoints) + ")", 24);
-        title.setFillColor(sf::Color::White);
-        title.setPosition(sf::Vector2f(pos.x + 50, pos.y + 50));
-        window.draw(title);
-        
-        float startY = pos.y + 100;
-        float gap = 35.0f;
-        
+        pointsText.setNumber("Stats Upgrade (Points: ", player.skillPoints, ")");
+        pointsText.setPosition(sf::Vector2f(pos.x + 50, pos.y + 50));
+        pointsText.draw(window);
+
+        if (chromeCached)
+            drawChrome(window, statsBackground, pos);
+        else
+            drawStatsBackground(window, pos);
+
         // Render 8 stat bars with distinct colors
-        drawStatBar(window, font, {pos.x + 50, startY + gap*0}, "Health Regen", player.statLevels[0], sf::Color(255, 150, 100), player.skillPoints > 0, mousePos, 0, player);
-        drawStatBar(window, font, {pos.x + 50, startY + gap*1}, "Max Health", player.statLevels[1], sf::Color(255, 100, 255), player.skillPoints > 0, mousePos, 1, player);
-        drawStatBar(window, font, {pos.x + 50, startY + gap*2}, "Body Damage", player.statLevels[2], sf::Color(150, 100, 255), player.skillPoints > 0, mousePos, 2, player);
-        drawStatBar(window, font, {pos.x + 50, startY + gap*3}, "Bullet Speed", player.statLevels[3], sf::Color(100, 150, 255), player.skillPoints > 0, mousePos, 3, player);
-        drawStatBar(window, font, {pos.x + 50, startY + gap*4}, "Bullet Pen.", player.statLevels[4], sf::Color(255, 255, 100), player.skillPoints > 0, mousePos, 4, player);
-        drawStatBar(window, font, {pos.x + 50, startY + gap*5}, "Bullet Damage", player.statLevels[5], sf::Color(255, 100, 100), player.skillPoints > 0, mousePos, 5, player);
-        drawStatBar(window, font, {pos.x + 50, startY + gap*6}, "Reload", player.statLevels[6], sf::Color(100, 255, 100), player.skillPoints > 0, mousePos, 6, player);
-        drawStatBar(window, font, {pos.x + 50, startY + gap*7}, "Movement Spd", player.statLevels[7], sf::Color(100, 255, 255), player.skillPoints > 0, mousePos, 7, player);
-        
+        for (int i = 0; i < 8; i++)
+        {
+            sf::Vector2f barPos(pos.x + statBarX, pos.y + statBarY + statBarGap * i);
+            drawStatBar(window, barPos, player.statLevels[i], statBars[i].color, player.skillPoints > 0, mousePos);
+        }
+
+        // Labels go over the fills, the buttons never overlap them
+        if (chromeCached)
+            drawChrome(window, statsLabels, pos);
+        else
+            drawStatsLabels(window, pos);
+
         // Tank Upgrade Button
-        if (player.level >= 10 && player.currentTank->getTier() < 3)
+        if (player.level >= 10 && player.currentTank.getTier() < 3)
         {
-            sf::RectangleShape btn(sf::Vector2f(200.0f, 40.0f));
-            btn.setPosition(sf::Vector2f(pos.x + size.x - 250, pos.y + 50));
-            btn.setFillColor(sf::Color(0, 100, 200));
-            window.draw(btn);
-            
-            sf::Text txt(font, "Tank Upgrade ->", 18);
-            txt.setFillColor(sf::Color::White);
-            centerText(txt, pos.x + size.x - 150, pos.y + 70);
-            window.draw(txt);
+            tankUpgradeButton.setPosition(sf::Vector2f(pos.x + size.x - 250, pos.y + 50));
+            window.draw(tankUpgradeButton);
+
+            tankUpgradeText.setPosition(sf::Vector2f(pos.x + size.x - 150, pos.y + 70));
+            tankUpgradeText.draw(window);
         }
     }
     else if (uw.getState() == UpgradeWindowState::ClassSelection)
     {
-        sf::Text title(font, "Select Class", 30);
-        title.setFillColor(sf::Color::White);
-        centerText(title, pos.x + size.x/2, pos.y + 50);
-        window.draw(title);
-        
-        // Back Button
-        sf::RectangleShape backBtn(sf::Vector2f(100.0f, 30.0f));
-        backBtn.setPosition(sf::Vector2f(pos.x + 20, pos.y + 20));
-        backBtn.setFillColor(sf::Color(100, 100, 100));
-        window.draw(backBtn);
-        
-        sf::Text backTxt(font, "<- Back", 16);
-        backTxt.setFillColor(sf::Color::White);
-        centerText(backTxt, pos.x + 70, pos.y + 35);
-        window.draw(backTxt);
-        
-        auto upgrades = player.currentTank->getUpgrades();
-        
+        if (chromeCached)
+            drawChrome(window, classChrome, pos);
+        else
+            drawClassChrome(window, pos, size);
+
+        TankList upgrades = player.currentTank.getUpgrades();
+
         // Draw Class Options in grid
-        float startX = pos.x + 100;
-        float startY = pos.y + 150;
-        float boxSize = 120;
-        float gap = 30;
-        
+        float startX = pos.x + classGridX;
+        float startY = pos.y + classGridY;
+        previewQuads.clear();
+
         for (size_t i = 0; i < upgrades.size(); i++)
         {
-            float x = startX + (i % 3) * (boxSize + gap);
-            float y = startY + (i / 3) * (boxSize + gap);
-            
-            sf::RectangleShape box(sf::Vector2f(boxSize, boxSize));
-            box.setPosition(sf::Vector2f(x, y));
-            box.setFillColor(sf::Color(0, 178, 225));
-            box.setOutlineColor(sf::Color::White);
-            box.setOutlineThickness(2);
-            window.draw(box);
-            
+            float x = startX + (i % 3) * (classBoxSize + classBoxGap);
+            float y = startY + (i / 3) * (classBoxSize + classBoxGap);
+
+            classBox.setPosition(sf::Vector2f(x, y));
+            window.draw(classBox);
+
             // Preview tank configuration
-            Player tempPlayer(15.0f, 0.0f, x + boxSize/2, y + boxSize/2);
-            upgrades[i]->configure(tempPlayer);
-            tempPlayer.draw(window);
-            
-            sf::Text nameTxt(font, upgrades[i]->getName(), 14);
-            nameTxt.setFillColor(sf::Color::White);
-            centerText(nameTxt, x + boxSize/2, y + boxSize + 15);
-            window.draw(nameTxt);
+            addPreview(upgrades[i], sf::Vector2f(x, y));
+
+            classNames[i].setString(upgrades[i].getName());
+            classNames[i].setPosition(sf::Vector2f(x + classBoxSize/2, y + classBoxSize + 15));
+            classNames[i].draw(window);
         }
+        previewFallback.flush(window);
+        if (!previewQuads.empty())
+            window.draw(previewQuads.data(), previewQuads.size(), sf::PrimitiveType::Triangles, sf::RenderStates(&previewAtlas.getTexture()));
     }
 }
@@ -53,47 +53,5 @@ void UpgradeWindow::draw(sf::RenderWindow &window, const sf::Font &font)
     if (!visible)
         return;
 
-    float x = winLeft;
-    float y = winTop - titleBarHeight;
-
-    // Title bar
-    sf::RectangleShape titleBar(sf::Vector2f(windowWidth, titleBarHeight));
-    titleBar.setPosition(sf::Vector2f(x, y));
-    titleBar.setFillColor(sf::Color(45, 45, 48));
-    window.draw(titleBar);
-
-    sf::Text titleText(font, "Upgrade Shop", 14);
-    titleText.setFillColor(sf::Color::White);
-    titleText.setPosition(sf::Vector2f(x + 10, y + 7));
-    window.draw(titleText);
-
-    // Controls
-    float buttonSize = 12.0f;
-    float buttonY = y + titleBarHeight / 2.0f - buttonSize / 2.0f;
-
-    auto drawBtn = [&](float offsetX, sf::Color col)
-    {
-        sf::CircleShape btn(buttonSize / 2.0f);
-        btn.setPosition(sf::Vector2f(x + windowWidth - offsetX - buttonSize, buttonY));
-        btn.setFillColor(col);
-        window.draw(btn);
-    };
-
-    drawBtn(15, sf::Color(255, 95, 86));   // Close
-    drawBtn(35, sf::Color(40, 201, 64));   // Maximize
-    drawBtn(55, sf::Color(255, 189, 46));  // Minimize
-
-    // Background
-    sf::RectangleShape background(sf::Vector2f(windowWidth, windowHeight));
-    background.setPosition(sf::Vector2f(winLeft, winTop));
-    background.setFillColor(sf::Color(20, 20, 25));
-    window.draw(background);
-
-    // Border
-    sf::RectangleShape border(sf::Vector2f(windowWidth, windowHeight + titleBarHeight));
-    border.setPosition(sf::Vector2f(x, y));
-    border.setFillColor(sf::Color::Transparent);
-    border.setOutlineColor(sf::Color(100, 100, 100));
-    border.setOutlineThickness(borderThickness);
-    window.draw(border);
+    drawFrame(window, font, sf::FloatRect(getPosition(), getSize()), "Upgrade Shop", sf::Color(20, 20, 25));
 }
@@ -6,7 +6,11 @@
 #include <sstream>
 #include <iomanip>
 #include <iostream>
+#include <fstream>
 #include <memory>
+#include <string>
+#include <cstdlib>
+#include <random>
 
 #include "../include/GameState.hpp"
 #include "../include/Upgrade.hpp"
@@ -16,14 +20,31 @@
 #include "../include/ShoppingWindow.hpp"
 #include "../include/WelcomeWindow.hpp"
 #include "../include/UpgradeWindow.hpp"
-#include "../include/Bullet.hpp"
 #include "../include/Enemy.hpp"
 #include "../include/Player.hpp"
+#include "../include/InputFrame.hpp"
+#include "../include/Simulation.hpp"
+#include "../include/Replay.hpp"
+#include "../include/BatchRenderer.hpp"
+#include "../include/Profiler.hpp"
+#include "../include/AllocCounter.hpp"
 #include "../include/UIRenderer.hpp"
 #include "../include/TankClass.hpp"
 
-int main()
+int main(int argc, char **argv)
 {
+    // Simulation ticks per second, independent of the display rate
+    float tickRate = 60.0f;
+    // Every run is recorded here so it can be replayed with tools/replay
+    std::string replayPath = "windowshock_last.replay";
+    for (int i = 1; i + 1 < argc; i++)
+    {
+        if (std::string(argv[i]) == "--tick-rate")
+            tickRate = std::max(1.0f, static_cast<float>(std::atof(argv[++i])));
+        else if (std::string(argv[i]) == "--record")
+            replayPath = argv[++i];
+    }
+
     // Retrieve screen resolution
     int screenWidth = GetSystemMetrics(SM_CXSCREEN);
     int screenHeight = GetSystemMetrics(SM_CYSCREEN);
@@ -51,26 +72,35 @@ int main()
             return -1;
 
     // Game object initialization
-    std::unique_ptr<FakeWindow> currentWindow = std::make_unique<WelcomeWindow>(screenWidth, screenHeight, 675.0f);
+    std::unique_ptr<FakeWindow> welcomeWindow = std::make_unique<WelcomeWindow>(screenWidth, screenHeight, 675.0f);
+    FakeWindow *currentWindow = welcomeWindow.get();
     
     UpgradeWindow upgradeWindow(screenWidth, screenHeight);
-    Player player(15.0f, 5.0f, screenWidth / 2.0f, screenHeight / 2.0f);
+
+    // Gameplay state lives in the simulation, the loop below only feeds it input
+    Simulation sim(screenWidth, screenHeight, tickRate);
+    Player &player = sim.getPlayer();
+
+    Replay replay;
+    std::random_device seedSource;
 
     GameState currentState = GameState::WELCOME;
-    GameStats stats;
     bool isTransitioningToPlay = false;
 
-    std::vector<Bullet> bullets;
-    std::vector<Bullet> enemyBullets;
-    std::vector<std::shared_ptr<Enemy>> enemies;
-
-    sf::Clock shootClock;
-    sf::Clock gameTimeClock;
-    sf::Clock enemySpawnClock;
     sf::Clock deltaTimeClock;
     
     sf::View defaultView = window.getDefaultView();
 
+    // All entities are tessellated into this and drawn in one call
+    BatchRenderer batch;
+
+    // Keeps HUD text and upgrade window chrome between frames
+    UIRenderer ui(font, upgradeWindow.getSize());
+
+    // Loading the font and baking the UI is allowed to allocate
+    bool allocBudgetArmed = false;
+    int framesDrawn = 0;
+
     while (window.isOpen())
     {
         float deltaTime = deltaTimeClock.restart().asSeconds();
@@ -90,6 +120,7 @@ int main()
         // Event processing
         while (auto eventOpt = window.pollEvent())
         {
+            PROFILE_SCOPE("Event handling");
             const sf::Event &event = *eventOpt;
             if (event.is<sf::Event::Closed>())
                 window.close();
@@ -105,21 +136,14 @@ int main()
                     {
                         isTransitioningToPlay = true;
                         
-                        float currentSize = currentWindow->getWidth();
-                        currentWindow = std::make_unique<PlayingWindow>(screenWidth, screenHeight, currentSize);
+                        // Reset state and collapse from the current size
+                        sim.reset(currentWindow->getWidth(), (static_cast<uint64_t>(seedSource()) << 32) | seedSource());
+                        sim.startRecording(replay);
+                        AllocCounter::skipFrame();
+                        currentWindow = &sim.getWindow();
                         
-                        currentWindow->startCollapseAnimation();
                         currentState = GameState::PLAYING;
                         upgradeWindow.hide();
-                        gameTimeClock.restart();
-                        enemySpawnClock.restart();
-
-                        // Reset state
-                        player = Player(15.0f, 5.0f, screenWidth / 2.0f, screenHeight / 2.0f);
-                        bullets.clear();
-                        enemyBullets.clear();
-                        enemies.clear();
-                        stats = GameStats();
                     }
                 }
                 
@@ -160,16 +184,16 @@ int main()
                             sf::FloatRect btnRect(sf::Vector2f(winPos.x + 50 + 260.0f, startY + gap * i), sf::Vector2f(20.0f, 20.0f));
                             if (btnRect.contains(mousePosF))
                             {
-                                player.upgradeStat(i);
+                                sim.execute({0, CommandType::UpgradeStat, i});
                             }
                         }
                         
                         // Handle tank upgrades
                         bool canUpgrade = false;
-                        auto upgrades = player.currentTank->getUpgrades();
+                        TankList upgrades = player.currentTank.getUpgrades();
                         if (!upgrades.empty())
                         {
-                            int currentTier = player.currentTank->getTier();
+                            int currentTier = player.currentTank.getTier();
                             if ((currentTier == 1 && player.level >= 10) || (currentTier == 2 && player.level >= 20))
                                 canUpgrade = true;
                         }
@@ -193,7 +217,7 @@ int main()
                         }
                         
                         // Handle class selection
-                        auto upgrades = player.currentTank->getUpgrades();
+                        TankList upgrades = player.currentTank.getUpgrades();
                         float startX = winPos.x + 100;
                         float startY = winPos.y + 150;
                         float boxSize = 120;
@@ -207,7 +231,7 @@ int main()
                             
                             if (box.contains(mousePosF))
                             {
-                                player.setTank(upgrades[i]);
+                                sim.execute({0, CommandType::SelectTank, static_cast<int>(i)});
                                 upgradeWindow.toggle();
                             }
                         }
@@ -219,187 +243,23 @@ int main()
         // Core game logic update
         if (currentState == GameState::PLAYING && !isTransitioningToPlay && !upgradeWindow.getVisible())
         {
-            stats.timeSurvived = static_cast<int>(gameTimeClock.getElapsedTime().asSeconds());
-            currentWindow->update(deltaTime);
-            
-            // Player orientation
-            sf::Vector2f playerPos = player.getPosition();
-            sf::Vector2f dir = mouseWorldPos - playerPos;
-            float angle = std::atan2(dir.y, dir.x) * 180.0f / 3.14159f;
-            player.setRotation(angle);
-            
-            player.handleInput();
-            player.update(deltaTime);
-            player.constrainToWindow(*currentWindow);
-
-            // Player shooting
-            if (sf::Mouse::isButtonPressed(sf::Mouse::Button::Left) && player.reloadTimer <= 0.0f)
-            {
-                std::vector<Bullet> newBullets = player.createBullets(mouseWorldPos);
-                bullets.insert(bullets.end(), newBullets.begin(), newBullets.end());
-                player.reloadTimer = player.currentReload;
-            }
+            InputFrame input;
+            input.moveUp = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::W);
+            input.moveDown = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::S);
+            input.moveLeft = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::A);
+            input.moveRight = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::D);
+            input.fire = sf::Mouse::isButtonPressed(sf::Mouse::Button::Left);
+            input.aimPos = mouseWorldPos;
 
-            // Update player bullets
-            for (auto it = bullets.begin(); it != bullets.end();)
             {
-                it->update(deltaTime);
-                
-                // Wall collisions
-                bool hitWall = false;
-                sf::Vector2f bPos = it->getPosition();
-                
-                PlayingWindow* playingWin = dynamic_cast<PlayingWindow*>(currentWindow.get());
-                if (playingWin)
-                {
-                    if (bPos.x < playingWin->getLeft()) { playingWin->hitWall(0); hitWall = true; }
-                    else if (bPos.x > playingWin->getRight()) { playingWin->hitWall(1); hitWall = true; }
-                    else if (bPos.y < playingWin->getTop()) { playingWin->hitWall(2); hitWall = true; }
-                    else if (bPos.y > playingWin->getBottom()) { playingWin->hitWall(3); hitWall = true; }
-                }
-                
-                if (hitWall) it = bullets.erase(it);
-                else ++it;
-            }
-
-            // Update enemy bullets
-            for (auto it = enemyBullets.begin(); it != enemyBullets.end();)
-            {
-                it->update(deltaTime);
-                
-                // Player collision
-                sf::Vector2f bPos = it->getPosition();
-                sf::Vector2f pPos = player.getPosition();
-                float dist = std::sqrt(std::pow(bPos.x - pPos.x, 2) + std::pow(bPos.y - pPos.y, 2));
-                
-                if (dist < player.getRadius() + it->getRadius())
-                {
-                    player.takeDamage(it->getDamage());
-                    it = enemyBullets.erase(it);
-                    continue;
-                }
-
-                // Wall collision
-                bool hitWall = false;
-                PlayingWindow* playingWin = dynamic_cast<PlayingWindow*>(currentWindow.get());
-                if (playingWin)
-                {
-                    sf::Vector2f bPos = it->getPosition();
-                    if (bPos.x < playingWin->getLeft() || bPos.x > playingWin->getRight() ||
-                        bPos.y < playingWin->getTop() || bPos.y > playingWin->getBottom())
-                    {
-                        hitWall = true;
-                    }
-                }
-
-                if (hitWall) it = enemyBullets.erase(it);
-                else ++it;
+                PROFILE_SCOPE("Simulation");
+                sim.advance(deltaTime, input);
             }
 
-            // Enemy Spawning
-            if (enemySpawnClock.getElapsedTime().asSeconds() > 2.0f)
-            {
-                // Calculate spawn position outside window
-                float buffer = 50.0f;
-                float x, y;
-                int side = rand() % 4;
-                
-                if (side == 0) // Top
-                {
-                    x = currentWindow->getLeft() + static_cast<float>(rand() % (int)currentWindow->getWidth());
-                    y = currentWindow->getTop() - buffer;
-                }
-                else if (side == 1) // Bottom
-                {
-                    x = currentWindow->getLeft() + static_cast<float>(rand() % (int)currentWindow->getWidth());
-                    y = currentWindow->getBottom() + buffer;
-                }
-                else if (side == 2) // Left
-                {
-                    x = currentWindow->getLeft() - buffer;
-                    y = currentWindow->getTop() + static_cast<float>(rand() % (int)currentWindow->getHeight());
-                }
-                else // Right
-                {
-                    x = currentWindow->getRight() + buffer;
-                    y = currentWindow->getTop() + static_cast<float>(rand() % (int)currentWindow->getHeight());
-                }
-
-                sf::Vector2f spawnPos(x, y);
-                int roll = rand() % 100;
-                int time = stats.timeSurvived; 
-                
-                // Check if boss active
-                bool bossExists = false;
-                for(const auto& e : enemies) if(dynamic_cast<Spiker*>(e.get())) bossExists = true;
-                
-                // Spawn logic
-                if (time > 60 && !bossExists && (rand() % 20 == 0))
-                {
-                    enemies.emplace_back(std::make_shared<Spiker>(spawnPos));
-                }
-                else
-                {
-                    if (roll < 50) enemies.emplace_back(std::make_shared<Triangle>(spawnPos));
-                    else if (roll < 75) enemies.emplace_back(std::make_shared<Circle>(spawnPos));
-                    else enemies.emplace_back(std::make_shared<Square>(spawnPos));
-                }
-                
-                enemySpawnClock.restart();
-            }
-
-            // Update enemies
-            for (auto it = enemies.begin(); it != enemies.end();)
-            {
-                std::vector<Bullet> newEnemyBullets = (*it)->update(player.getPosition(), deltaTime);
-                enemyBullets.insert(enemyBullets.end(), newEnemyBullets.begin(), newEnemyBullets.end());
-                
-                // Player collision
-                sf::Vector2f ePos = (*it)->getPosition();
-                sf::Vector2f pPos = player.getPosition();
-                float dist = std::sqrt(std::pow(ePos.x - pPos.x, 2) + std::pow(ePos.y - pPos.y, 2));
-                if (dist < player.getRadius() + (*it)->getRadius())
-                {
-                    player.takeDamage(20);
-                    if (dynamic_cast<Spiker*>(it->get())) player.takeDamage(100);
-                    
-                    // Apply body damage to enemy
-                    (*it)->takeDamage(static_cast<int>(player.currentBodyDamage)); 
-                }
-
-                // Bullet collision
-                bool bulletHit = false;
-                for (auto bit = bullets.begin(); bit != bullets.end();)
-                {
-                    sf::Vector2f bPos = bit->getPosition();
-                    float bDist = std::sqrt(std::pow(ePos.x - bPos.x, 2) + std::pow(ePos.y - bPos.y, 2));
-                    if (bDist < (*it)->getRadius() + bit->getRadius())
-                    {
-                        (*it)->takeDamage(bit->getDamage());
-                        bit = bullets.erase(bit);
-                        bulletHit = true;
-                        break;
-                    }
-                    else
-                    {
-                        ++bit;
-                    }
-                }
-
-                if ((*it)->isDead())
-                {
-                    player.earnXp((*it)->getCurrencyDrop() * 10);
-                    stats.enemiesKilled++;
-                    it = enemies.erase(it);
-                }
-                else if (!bulletHit)
-                {
-                    ++it;
-                }
-            }
-
-            if (player.isDead())
+            if (sim.isPlayerDead())
             {
+                sim.stopRecording();
+                replay.save(replayPath);
                 currentWindow->resize(675.0f);
                 currentState = GameState::GAMEOVER;
             }
@@ -409,39 +269,79 @@ int main()
         window.clear(sf::Color(255, 0, 255)); // Transparent key
 
         window.setView(defaultView);
-        currentWindow->draw(window, font);
+        {
+            PROFILE_SCOPE("FakeWindow::draw");
+            currentWindow->draw(window, font);
+        }
 
         if (currentState == GameState::PLAYING && !isTransitioningToPlay)
         {
             // Draw with clipping
             window.setView(currentWindow->getClippingView());
-
-            for (auto &e : enemies) e->draw(window);
-            for (auto &b : bullets) b.draw(window);
-            for (auto &b : enemyBullets) b.draw(window);
-            player.draw(window);
+            {
+                PROFILE_SCOPE("Entity draw");
+
+                // Blend between the last two ticks so motion stays smooth at any tick rate
+                float alpha = sim.getInterpolationAlpha();
+                sim.getEnemies().forEach([&](const Enemy &e) { e.draw(batch, alpha); });
+                sim.getBullets().draw(batch, alpha);
+                sim.getEnemyBullets().draw(batch, alpha);
+                player.draw(batch, alpha);
+                batch.flush(window);
+            }
 
             // Draw HUD
             window.setView(defaultView);
-            UIRenderer::drawHUD(window, font, player, *currentWindow);
+            {
+                PROFILE_SCOPE("UIRenderer::drawHUD");
+                ui.drawHUD(window, player, *currentWindow);
+            }
         }
         else if (currentState == GameState::WELCOME)
         {
-            UIRenderer::drawWelcomeScreen(window, font, *currentWindow);
+            ui.drawWelcomeScreen(window, *currentWindow);
         }
         else if (currentState == GameState::GAMEOVER)
         {
-            UIRenderer::drawGameOverScreen(window, font, stats, *currentWindow);
+            ui.drawGameOverScreen(window, sim.getStats(), *currentWindow);
         }
 
         if (upgradeWindow.getVisible())
         {
             upgradeWindow.draw(window, font);
-            UIRenderer::drawUpgradeWindow(window, font, player, mousePixelPos, upgradeWindow);
+            ui.drawUpgradeWindow(window, player, mousePixelPos, upgradeWindow);
         }
 
-        window.display();
+        {
+            PROFILE_SCOPE("window.display");
+            window.display();
+        }
+
+        PROFILE_COUNTER("Heap allocations", AllocCounter::endFrame());
+        Profiler::endFrame();
+
+        // Steady state from here on, hold every frame to zero allocations
+        if (!allocBudgetArmed && ++framesDrawn == 120)
+        {
+            AllocCounter::setBudget(0);
+            allocBudgetArmed = true;
+        }
     }
 
+    // Keep a run that was still going when the window closed
+    if (sim.isRecording())
+    {
+        sim.stopRecording();
+        replay.save(replayPath);
+    }
+
+    // Profile of the session, written next to the executable
+    Profiler::writeChromeTrace("windowshock_trace.json");
+    std::ofstream summary("windowshock_profile.txt");
+    Profiler::printSummary(summary);
+    if (AllocCounter::isEnabled())
+        summary << "\nFrames over the allocation budget: " << AllocCounter::getFramesOverBudget()
+                << " (worst " << AllocCounter::getWorstFrame() << " allocations)\n";
+
     return 0;
 }
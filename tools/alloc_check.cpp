@@ -0,0 +1,177 @@
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+#include "../include/AllocCounter.hpp"
+#include "../include/BulletPool.hpp"
+#include "../include/Enemy.hpp"
+#include "../include/EnemyPool.hpp"
+#include "../include/EnemyStore.hpp"
+#include "../include/FlowField.hpp"
+#include "../include/FrameArena.hpp"
+#include "../include/Player.hpp"
+#include "../include/TankClass.hpp"
+
+// Fails if the steady-state shooting, class switching, enemy spawning or frame scratch paths touch the heap,
+// or if an enemy handle still resolves after its enemy is gone
+// Usage: alloc_check [frames]
+
+#ifdef WINDOWSHOCK_COUNT_ALLOCS
+// The game's own hooks are linked in, read their count
+static long allocations() { return static_cast<long>(AllocCounter::getTotal()); }
+#else
+static long allocationCount = 0;
+static long allocations() { return allocationCount; }
+
+void *operator new(std::size_t size)
+{
+    allocationCount++;
+    if (void *p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+#endif
+
+// Handles must stop resolving once their enemy is removed, cleared or resized
+// away, and must never pick up a later enemy that reuses the slot
+static int checkHandles()
+{
+    int failures = 0;
+    auto expect = [&](bool ok, const char *what)
+    {
+        if (!ok)
+        {
+            std::cout << "FAIL: " << what << "\n";
+            failures++;
+        }
+    };
+
+    EnemyStore store(4);
+    EnemyHandle first = store.spawn<Circle>(sf::Vector2f(10.0f, 10.0f));
+    EnemyHandle second = store.spawn<Circle>(sf::Vector2f(20.0f, 20.0f));
+    expect(store.isAlive(first) && store.isAlive(second), "fresh handles resolve");
+    expect(!store.isAlive(EnemyHandle()), "default handle is null");
+
+    // Removing the first moves the second into its packed index
+    store.remove<Circle>(0);
+    expect(store.get(first) == nullptr, "handle is null after remove");
+    expect(store.get(second) && store.get(second)->getPosition() == sf::Vector2f(20.0f, 20.0f), "moved enemy keeps its handle");
+
+    // The freed slot is handed out again
+    EnemyHandle reused = store.spawn<Circle>(sf::Vector2f(30.0f, 30.0f));
+    expect(reused.slot == first.slot, "freed slot is reused");
+    expect(store.get(first) == nullptr, "old handle is null after slot reuse");
+    expect(store.get(reused) && store.get(reused)->getPosition() == sf::Vector2f(30.0f, 30.0f), "reused slot resolves to the new enemy");
+    expect(store.get(EnemyHandle{reused.slot, reused.generation, EnemyType::Square}) == nullptr, "handle of another type is null");
+
+    store.clear();
+    expect(!store.isAlive(second) && !store.isAlive(reused), "handles are null after clear");
+    EnemyHandle afterClear = store.spawn<Circle>(sf::Vector2f(40.0f, 40.0f));
+    expect(!store.isAlive(second) && !store.isAlive(reused) && store.isAlive(afterClear), "slots reused after clear don't alias");
+
+    store.setCapacity(4);
+    expect(!store.isAlive(afterClear), "handles are null after setCapacity");
+    EnemyHandle afterResize = store.spawn<Circle>(sf::Vector2f(50.0f, 50.0f));
+    expect(!store.isAlive(afterClear) && !store.isAlive(second) && store.isAlive(afterResize), "slots reused after setCapacity don't alias");
+
+    // Shrinking drops the high slots, growing again must not revive their handles
+    for (int i = 1; i < 4; i++)
+        store.spawn<Circle>(sf::Vector2f(60.0f, 60.0f));
+    EnemyHandle highSlot = store.getHandle<Circle>(3);
+    store.setCapacity(2);
+    store.setCapacity(4);
+    for (int i = 0; i < 4; i++)
+        store.spawn<Circle>(sf::Vector2f(70.0f, 70.0f));
+    expect(!store.isAlive(highSlot), "handles are null after shrinking and growing");
+    expect(store.size() == 4, "every slot is free after setCapacity");
+
+    return failures;
+}
+
+int main(int argc, char **argv)
+{
+    int frames = argc > 1 ? std::atoi(argv[1]) : 600;
+    const float dt = 1.0f / 60.0f;
+
+    BulletPool playerBullets(4096, BulletOwner::Player);
+    BulletPool enemyBullets(4096, BulletOwner::Enemy);
+
+    // Widest player spread and the only shooting enemy
+    Player player(15.0f, 5.0f, 960.0f, 540.0f);
+    player.setTank(TankId::Gunner);
+    Spiker spiker(sf::Vector2f(600.0f, 540.0f));
+    EnemyPool<Triangle> triangles(256);
+    EnemyStore timedEnemies(256);
+    FrameArena arena(16 * 1024);
+    FlowField flow(sf::Vector2f(1920.0f, 1080.0f));
+    const WallBounds walls = {600.0f, 1320.0f, 200.0f, 880.0f};
+
+    long before = allocations();
+    for (int frame = 0; frame < frames; frame++)
+    {
+        player.createBullets(sf::Vector2f(1200.0f, 540.0f), playerBullets);
+        // Player wandering across cells so the flow field rebuilds
+        flow.update(player.getPosition() + sf::Vector2f(static_cast<float>(frame % 200), 0.0f), walls, 100000);
+        // Woken every frame instead of by the timer wheel so it fires every frame
+        spiker.wake(flow);
+        spiker.update(flow, sf::Vector2f(0.0f, 0.0f), dt, enemyBullets);
+
+        // Keep the pools from filling up so every frame really fires
+        playerBullets.clear();
+        if (enemyBullets.size() > 2048)
+            enemyBullets.clear();
+    }
+
+    // Walking the class tree and switching class must not allocate either
+    for (int frame = 0; frame < frames; frame++)
+    {
+        Tank tank = static_cast<TankId>(frame % static_cast<int>(TankId::Count));
+        for (TankId next : tank.getUpgrades())
+            if (Tank(next).getTier() > tank.getTier())
+                player.setTank(next);
+        player.setTank(tank);
+    }
+
+    // Spawn and kill churn reuses pool slots and timer wheel nodes
+    for (int frame = 0; frame < frames; frame++)
+    {
+        triangles.spawn(sf::Vector2f(100.0f, 100.0f));
+        if (triangles.size() > 128)
+            triangles.remove(frame % triangles.size());
+
+        timedEnemies.spawn<Circle>(sf::Vector2f(100.0f, 100.0f));
+        timedEnemies.spawn<Square>(sf::Vector2f(100.0f, 100.0f));
+        if (timedEnemies.size() > 128)
+        {
+            timedEnemies.remove<Circle>(0);
+            timedEnemies.remove<Square>(0);
+        }
+        timedEnemies.updateTimers(flow);
+    }
+
+    // Scratch containers come out of the frame arena
+    for (int frame = 0; frame < frames; frame++)
+    {
+        FrameVector<sf::Vector2f> points(&arena);
+        for (int i = 0; i < 100; i++)
+            points.push_back(sf::Vector2f(static_cast<float>(i), static_cast<float>(frame)));
+        FrameString label("Frame ", &arena);
+        label.append(static_cast<size_t>(frame % 64), '.');
+        arena.reset();
+    }
+    long allocated = allocations() - before;
+
+    std::cout << "Frames: " << frames << ", heap allocations on the shooting, class switching, enemy spawning and frame scratch paths: " << allocated << "\n";
+    if (allocated != 0)
+    {
+        std::cout << "FAIL: expected zero allocations\n";
+        return 1;
+    }
+    if (checkHandles() != 0)
+        return 1;
+    std::cout << "OK\n";
+    return 0;
+}
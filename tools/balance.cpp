@@ -0,0 +1,200 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../include/Simulation.hpp"
+#include "../include/Bot.hpp"
+#include "../include/Profiler.hpp"
+
+// Monte-Carlo balance sweep: bots play many independent games for every class
+// path and stat strategy, one game per thread at a time, and the results are
+// summarised per build in a CSV
+// Usage: balance [gamesPerBuild] [threads] [csvFile] [maxMinutes]
+
+const float tickRate = 60.0f;
+
+struct Strategy
+{
+    const char *name;
+    int statPriority[8];
+    bool focus;
+};
+
+// Indices as in Player::statLevels: 0 regen, 1 max health, 2 body damage,
+// 3 bullet speed, 4 penetration, 5 bullet damage, 6 reload, 7 movement
+const Strategy strategies[] = {
+    {"balanced", {5, 6, 3, 1, 0, 7, 4, 2}, false},
+    {"glass cannon", {5, 6, 4, 3, 7, 1, 0, 2}, true},
+    {"bulwark", {1, 0, 2, 7, 5, 6, 3, 4}, true},
+    {"rammer", {2, 1, 0, 7, 6, 5, 3, 4}, true},
+    {"kiter", {7, 6, 3, 5, 1, 0, 4, 2}, true},
+};
+
+struct Build
+{
+    TankId tier2;
+    TankId tier3;
+    const Strategy *strategy;
+};
+
+struct GameResult
+{
+    double survived = 0.0; // Seconds
+    int kills = 0;
+    double level10 = -1.0; // Seconds until level 10, -1 if never reached
+    double level20 = -1.0;
+    long ticks = 0;
+};
+
+struct BuildSummary
+{
+    int games = 0;
+    double survivedSum = 0.0;
+    std::vector<double> survived;
+    long killsSum = 0;
+    int reached10 = 0, reached20 = 0;
+    double level10Sum = 0.0, level20Sum = 0.0;
+};
+
+// Every path from Basic down to a tier 3 class, taken from the class tree
+static std::vector<Build> makeBuilds()
+{
+    std::vector<Build> builds;
+    for (const Strategy &strategy : strategies)
+        for (TankId tier2 : Tank(TankId::Basic).getUpgrades())
+            for (TankId tier3 : Tank(tier2).getUpgrades())
+                builds.push_back({tier2, tier3, &strategy});
+    return builds;
+}
+
+static GameResult playGame(const Build &build, uint64_t seed, long maxTicks)
+{
+    BotBuild botBuild;
+    std::copy(std::begin(build.strategy->statPriority), std::end(build.strategy->statPriority), botBuild.statPriority);
+    botBuild.focus = build.strategy->focus;
+    botBuild.tier2 = build.tier2;
+    botBuild.tier3 = build.tier3;
+
+    // Games already run one per core, so each stays on its own thread
+    Simulation sim(1920, 1080, tickRate, 0);
+    float dt = sim.getTickDuration();
+    sim.reset(675.0f, seed);
+    sim.skipCollapseAnimation();
+    Bot bot(seed, botBuild);
+
+    GameResult result;
+    for (result.ticks = 0; result.ticks < maxTicks && !sim.isPlayerDead(); result.ticks++)
+    {
+        bot.spendPoints(sim);
+        sim.step(dt, bot.think(sim, dt));
+
+        int level = sim.getPlayer().level;
+        if (result.level10 < 0.0 && level >= 10)
+            result.level10 = sim.getTickCount() * dt;
+        if (result.level20 < 0.0 && level >= 20)
+            result.level20 = sim.getTickCount() * dt;
+    }
+    result.survived = sim.getTickCount() * dt;
+    result.kills = sim.getStats().enemiesKilled;
+    return result;
+}
+
+static double mean(double sum, int count)
+{
+    return count > 0 ? sum / count : 0.0;
+}
+
+int main(int argc, char **argv)
+{
+    int gamesPerBuild = argc > 1 ? std::atoi(argv[1]) : 20;
+    unsigned threads = argc > 2 ? static_cast<unsigned>(std::atoi(argv[2])) : std::thread::hardware_concurrency();
+    std::string csvPath = argc > 3 ? argv[3] : "balance.csv";
+    double maxMinutes = argc > 4 ? std::atof(argv[4]) : 15.0;
+    if (threads == 0)
+        threads = 1;
+
+    // Zones from every thread would fight over the profiler's shared ring buffer
+    Profiler::setEnabled(false);
+
+    std::vector<Build> builds = makeBuilds();
+    long maxTicks = static_cast<long>(maxMinutes * 60.0 * tickRate);
+    size_t totalGames = builds.size() * static_cast<size_t>(gamesPerBuild);
+
+    // Games are independent, threads pull the next index until none are left.
+    // Results land in their own slot so the CSV does not depend on thread count.
+    std::vector<GameResult> results(totalGames);
+    std::atomic<size_t> nextGame{0};
+    auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> pool;
+    for (unsigned t = 0; t < threads; t++)
+    {
+        pool.emplace_back([&]()
+        {
+            for (size_t game = nextGame++; game < totalGames; game = nextGame++)
+            {
+                const Build &build = builds[game / gamesPerBuild];
+                uint64_t seed = 1 + game % gamesPerBuild;
+                results[game] = playGame(build, seed, maxTicks);
+            }
+        });
+    }
+    for (std::thread &t : pool)
+        t.join();
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    // Per build summary
+    std::vector<BuildSummary> summaries(builds.size());
+    long totalTicks = 0;
+    for (size_t game = 0; game < totalGames; game++)
+    {
+        const GameResult &r = results[game];
+        BuildSummary &s = summaries[game / gamesPerBuild];
+        s.games++;
+        s.survivedSum += r.survived;
+        s.survived.push_back(r.survived);
+        s.killsSum += r.kills;
+        if (r.level10 >= 0.0)
+        {
+            s.reached10++;
+            s.level10Sum += r.level10;
+        }
+        if (r.level20 >= 0.0)
+        {
+            s.reached20++;
+            s.level20Sum += r.level20;
+        }
+        totalTicks += r.ticks;
+    }
+
+    std::ofstream csv(csvPath);
+    csv << "strategy,tier2,tier3,games,mean_survival_s,median_survival_s,mean_kills,"
+           "reached_level10,mean_time_to_level10_s,reached_level20,mean_time_to_level20_s\n";
+    for (size_t i = 0; i < builds.size(); i++)
+    {
+        BuildSummary &s = summaries[i];
+        std::sort(s.survived.begin(), s.survived.end());
+        double median = s.survived.empty() ? 0.0 : s.survived[s.survived.size() / 2];
+
+        csv << builds[i].strategy->name << ',' << Tank(builds[i].tier2).getName() << ',' << Tank(builds[i].tier3).getName() << ','
+            << s.games << ',' << mean(s.survivedSum, s.games) << ',' << median << ','
+            << mean(static_cast<double>(s.killsSum), s.games) << ','
+            << mean(s.reached10, s.games) << ',' << mean(s.level10Sum, s.reached10) << ','
+            << mean(s.reached20, s.games) << ',' << mean(s.level20Sum, s.reached20) << '\n';
+    }
+
+    std::cout << "Builds:     " << builds.size() << " (" << gamesPerBuild << " games each)\n";
+    std::cout << "Threads:    " << threads << "\n";
+    std::cout << "Wall time:  " << seconds << " s\n";
+    std::cout << "Games/sec:  " << (seconds > 0.0 ? totalGames / seconds : 0.0) << "\n";
+    std::cout << "Ticks/sec:  " << (seconds > 0.0 ? totalTicks / seconds : 0.0) << "\n";
+    std::cout << "Results written to " << csvPath << "\n";
+    return 0;
+}
@@ -0,0 +1,97 @@
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "../include/Simulation.hpp"
+#include "../include/TaskGraph.hpp"
+
+// Times every phase of Simulation::step and reports which chain of phases
+// bounds the frame, and how much each other phase could grow for free
+// Usage: critical_path [ticks] [workers] [dotFile]
+int main(int argc, char **argv)
+{
+    long ticks = argc > 1 ? std::atol(argv[1]) : 6000;
+    unsigned workers = argc > 2 ? static_cast<unsigned>(std::atoi(argv[2])) : JobSystem::getDefaultWorkerCount();
+    Simulation sim(1920, 1080, 60.0f, workers);
+    float dt = sim.getTickDuration();
+    sim.reset(675.0f, 1);
+    sim.skipCollapseAnimation();
+
+    const std::vector<TaskGraph::Task> &tasks = sim.getStepGraph().getTasks();
+    std::vector<double> total(tasks.size(), 0.0);
+    long measured = 0;
+
+    for (long tick = 0; tick < ticks; tick++)
+    {
+        // Same input as headless so the enemy count builds up the same way
+        InputFrame input;
+        float aimAngle = tick * dt * 2.0f;
+        input.fire = true;
+        input.aimPos = sim.getPlayer().getPosition() + sf::Vector2f(std::cos(aimAngle), std::sin(aimAngle)) * 100.0f;
+
+        sim.step(dt, input);
+        for (size_t i = 0; i < tasks.size(); i++)
+            total[i] += static_cast<double>(tasks[i].end - tasks[i].start) / 1000.0;
+        measured++;
+
+        if (sim.isPlayerDead())
+        {
+            sim.reset(675.0f, static_cast<uint64_t>(tick) + 1);
+            sim.skipCollapseAnimation();
+        }
+    }
+
+    std::vector<double> mean(tasks.size(), 0.0);
+    for (size_t i = 0; i < tasks.size(); i++)
+        mean[i] = measured > 0 ? total[i] / measured : 0.0;
+
+    TaskGraph::CriticalPath path = sim.getStepGraph().findCriticalPath(mean);
+    std::vector<bool> critical(tasks.size(), false);
+    for (int i : path.tasks)
+        critical[i] = true;
+
+    std::cout << "Ticks:   " << measured << "\n";
+    std::cout << "Workers: " << sim.getWorkerCount() << "\n\n";
+    std::cout << std::left << std::setw(20) << "Task" << std::right
+              << std::setw(12) << "mean us" << std::setw(12) << "finish us" << std::setw(12) << "slack us"
+              << "  depends on\n";
+    std::cout << std::fixed << std::setprecision(2);
+    for (size_t i = 0; i < tasks.size(); i++)
+    {
+        std::cout << (critical[i] ? "* " : "  ") << std::left << std::setw(18) << tasks[i].name << std::right
+                  << std::setw(12) << mean[i] << std::setw(12) << path.earliestFinish[i] << std::setw(12) << path.slack[i] << " ";
+        for (int dep : tasks[i].dependencies)
+            std::cout << " " << tasks[dep].name << ";";
+        std::cout << "\n";
+    }
+
+    std::cout << "\nCritical path:";
+    for (size_t i = 0; i < path.tasks.size(); i++)
+        std::cout << (i == 0 ? " " : " -> ") << tasks[path.tasks[i]].name;
+    std::cout << "\n";
+    std::cout << "Serial:   " << path.serialLength << " us\n";
+    std::cout << "Critical: " << path.length << " us\n";
+    if (path.length > 0.0)
+        std::cout << "Best case overlap speedup: " << path.serialLength / path.length << "x\n";
+
+    // Graphviz view of the graph, critical tasks in red
+    if (argc > 3)
+    {
+        std::ofstream dot(argv[3]);
+        dot << "digraph step {\n    rankdir=LR;\n    node [shape=box];\n";
+        for (size_t i = 0; i < tasks.size(); i++)
+        {
+            dot << "    t" << i << " [label=\"" << tasks[i].name << "\\n" << mean[i] << " us\"";
+            if (critical[i])
+                dot << ", color=red";
+            dot << "];\n";
+            for (int dep : tasks[i].dependencies)
+                dot << "    t" << dep << " -> t" << i << ";\n";
+        }
+        dot << "}\n";
+    }
+    return 0;
+}
@@ -0,0 +1,78 @@
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+#include "../include/Simulation.hpp"
+#include "../include/Profiler.hpp"
+#include "../include/AllocCounter.hpp"
+
+// Runs the game logic without a window so it can be profiled on any machine
+// Usage: headless [ticks] [tickRate] [traceFile]
+int main(int argc, char **argv)
+{
+    long ticks = argc > 1 ? std::atol(argv[1]) : 36000;
+    float tickRate = argc > 2 ? static_cast<float>(std::atof(argv[2])) : 60.0f;
+    Simulation sim(1920, 1080, tickRate);
+    float dt = sim.getTickDuration();
+    sim.reset(675.0f);
+
+    const long warmupTicks = 600;
+    long runs = 1;
+    long kills = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (long tick = 0; tick < ticks; tick++)
+    {
+        // Pools and scratch buffers have grown to size by now
+        if (tick == warmupTicks)
+            AllocCounter::setBudget(0);
+
+        // Skip the collapse animation, gameplay does not run during it
+        if (!sim.getWindow().isAnimationComplete())
+        {
+            sim.getWindow().update(dt);
+            continue;
+        }
+
+        // Keep firing while sweeping the aim around the player
+        InputFrame input;
+        float aimAngle = tick * dt * 2.0f;
+        input.fire = true;
+        input.aimPos = sim.getPlayer().getPosition() + sf::Vector2f(std::cos(aimAngle), std::sin(aimAngle)) * 100.0f;
+
+        sim.step(dt, input);
+        PROFILE_COUNTER("Heap allocations", AllocCounter::endFrame());
+        Profiler::endFrame();
+
+        if (sim.isPlayerDead())
+        {
+            kills += sim.getStats().enemiesKilled;
+            sim.reset(675.0f);
+            AllocCounter::skipFrame();
+            runs++;
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    kills += sim.getStats().enemiesKilled;
+
+    double seconds = std::chrono::duration<double>(end - start).count();
+    std::cout << "Ticks:         " << ticks << "\n";
+    std::cout << "Wall time:     " << seconds << " s\n";
+    std::cout << "Ticks/sec:     " << (seconds > 0.0 ? ticks / seconds : 0.0) << "\n";
+    std::cout << "Runs:          " << runs << "\n";
+    std::cout << "Enemies killed:" << kills << "\n";
+
+    EnemyPoolStats pool = sim.getEnemies().getStats();
+    std::cout << "Enemy pool:    " << pool.highWater << " peak / " << pool.capacity << " slots, "
+              << pool.spawned << " spawned, " << pool.rejected << " rejected\n";
+    if (AllocCounter::isEnabled())
+        std::cout << "Allocating ticks after warmup: " << AllocCounter::getFramesOverBudget()
+                  << " (worst " << AllocCounter::getWorstFrame() << ")\n";
+    std::cout << "\n";
+
+    Profiler::printSummary(std::cout);
+    if (argc > 3)
+        Profiler::writeChromeTrace(argv[3]);
+    return 0;
+}
@@ -0,0 +1,74 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include "../include/Simulation.hpp"
+#include "../include/Replay.hpp"
+#include "../include/Profiler.hpp"
+
+// Reruns a recorded session headless at full speed and checks it ends in the
+// same state it was recorded with
+// Usage: replay <file.replay> [repeats] [traceFile]
+int main(int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        std::cerr << "Usage: replay <file.replay> [repeats] [traceFile]\n";
+        return 2;
+    }
+
+    Replay replay;
+    if (!replay.load(argv[1]))
+    {
+        std::cerr << "Could not read replay " << argv[1] << "\n";
+        return 2;
+    }
+    int repeats = argc > 2 ? std::max(1, std::atoi(argv[2])) : 1;
+
+    Simulation sim(replay.screenWidth, replay.screenHeight, replay.tickRate);
+    float dt = sim.getTickDuration();
+    uint64_t checksum = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int run = 0; run < repeats; run++)
+    {
+        sim.reset(replay.initialSize, replay.seed);
+        sim.skipCollapseAnimation();
+
+        size_t nextCommand = 0;
+        for (size_t tick = 0; tick <= replay.frames.size(); tick++)
+        {
+            while (nextCommand < replay.commands.size() && replay.commands[nextCommand].tick == tick)
+                sim.execute(replay.commands[nextCommand++]);
+
+            if (tick == replay.frames.size())
+                break;
+
+            sim.step(dt, replay.frames[tick]);
+            Profiler::endFrame();
+        }
+        checksum = sim.getChecksum();
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double seconds = std::chrono::duration<double>(end - start).count();
+    size_t ticks = replay.frames.size() * repeats;
+    std::cout << "Seed:          " << replay.seed << "\n";
+    std::cout << "Ticks:         " << ticks << " (" << repeats << " x " << replay.frames.size() << ")\n";
+    std::cout << "Wall time:     " << seconds << " s\n";
+    std::cout << "Ticks/sec:     " << (seconds > 0.0 ? ticks / seconds : 0.0) << "\n";
+    std::cout << "Enemies killed:" << sim.getStats().enemiesKilled << "\n";
+    std::cout << "Checksum:      " << std::hex << checksum << std::dec << "\n";
+
+    bool matches = replay.finalChecksum == 0 || replay.finalChecksum == checksum;
+    if (!matches)
+        std::cout << "MISMATCH, recorded " << std::hex << replay.finalChecksum << std::dec << "\n";
+    std::cout << "\n";
+
+    Profiler::printSummary(std::cout);
+    if (argc > 3)
+        Profiler::writeChromeTrace(argv[3]);
+    return matches ? 0 : 1;
+}
@@ -0,0 +1,112 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "../include/Simulation.hpp"
+#include "../include/Bot.hpp"
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+// Load test: a bot plays back to back runs for the given number of simulated
+// minutes as fast as the machine allows. Needs no display.
+// Usage: soak [minutes] [workers] [seed]
+
+// Peak resident memory in KiB, or 0 where it cannot be read
+static long getPeakMemoryKb()
+{
+#ifndef _WIN32
+    rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+        return usage.ru_maxrss;
+#endif
+    return 0;
+}
+
+static double percentile(const std::vector<double> &sorted, double p)
+{
+    if (sorted.empty())
+        return 0.0;
+    size_t index = static_cast<size_t>(p / 100.0 * (sorted.size() - 1) + 0.5);
+    return sorted[index];
+}
+
+int main(int argc, char **argv)
+{
+    double minutes = argc > 1 ? std::atof(argv[1]) : 10.0;
+    unsigned workers = argc > 2 ? static_cast<unsigned>(std::atoi(argv[2])) : JobSystem::getDefaultWorkerCount();
+    uint64_t seed = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 1;
+
+    Simulation sim(1920, 1080, 60.0f, workers);
+    float dt = sim.getTickDuration();
+    long ticks = std::lround(minutes * 60.0 * sim.getTickRate());
+
+    Bot bot(seed);
+    sim.reset(675.0f, seed);
+    sim.skipCollapseAnimation();
+
+    std::vector<double> tickMs;
+    tickMs.reserve(static_cast<size_t>(ticks));
+    size_t peakEnemies = 0, peakBullets = 0, peakEnemyBullets = 0;
+    long runs = 1, kills = 0;
+    int bestLevel = 1;
+
+    auto start = std::chrono::steady_clock::now();
+    for (long tick = 0; tick < ticks; tick++)
+    {
+        auto tickStart = std::chrono::steady_clock::now();
+        bot.spendPoints(sim);
+        sim.step(dt, bot.think(sim, dt));
+        tickMs.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - tickStart).count());
+
+        peakEnemies = std::max(peakEnemies, sim.getEnemies().size());
+        peakBullets = std::max(peakBullets, sim.getBullets().size());
+        peakEnemyBullets = std::max(peakEnemyBullets, sim.getEnemyBullets().size());
+        bestLevel = std::max(bestLevel, sim.getPlayer().level);
+
+        if (sim.isPlayerDead())
+        {
+            kills += sim.getStats().enemiesKilled;
+            sim.reset(675.0f, seed + static_cast<uint64_t>(runs));
+            sim.skipCollapseAnimation();
+            runs++;
+        }
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    kills += sim.getStats().enemiesKilled;
+
+    std::cout << "Simulated:       " << minutes << " min (" << ticks << " ticks), " << sim.getWorkerCount() << " workers\n";
+    std::cout << "Wall time:       " << seconds << " s\n";
+    std::cout << "Ticks/sec:       " << (seconds > 0.0 ? ticks / seconds : 0.0) << "\n";
+    std::cout << "Runs:            " << runs << ", " << kills << " kills, best level " << bestLevel << "\n";
+    std::cout << "Peak enemies:    " << peakEnemies << "\n";
+    std::cout << "Peak bullets:    " << peakBullets << " player, " << peakEnemyBullets << " enemy\n";
+    long peakKb = getPeakMemoryKb();
+    if (peakKb > 0)
+        std::cout << "Peak memory:     " << peakKb / 1024.0 << " MiB\n";
+    else
+        std::cout << "Peak memory:     n/a\n";
+
+    std::sort(tickMs.begin(), tickMs.end());
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "\nTick time (ms)   p50 " << percentile(tickMs, 50) << "  p90 " << percentile(tickMs, 90)
+              << "  p99 " << percentile(tickMs, 99) << "  p99.9 " << percentile(tickMs, 99.9)
+              << "  max " << (tickMs.empty() ? 0.0 : tickMs.back()) << "\n";
+
+    // Histogram, the last bucket holds ticks that blew the real-time budget
+    const double bounds[] = {0.05, 0.1, 0.25, 0.5, 1.0, 2.0, 4.0, 8.0, dt * 1000.0};
+    size_t previous = 0;
+    for (double bound : bounds)
+    {
+        size_t count = static_cast<size_t>(std::upper_bound(tickMs.begin(), tickMs.end(), bound) - tickMs.begin());
+        std::cout << "  <= " << std::setw(7) << bound << " ms  " << std::setw(9) << count - previous << "\n";
+        previous = count;
+    }
+    std::cout << "  >  " << std::setw(7) << dt * 1000.0 << " ms  " << std::setw(9) << tickMs.size() - previous << "\n";
+    return 0;
+}